@@ -1,11 +1,15 @@
 """KNX IP component for ESPHome."""
+import logging
+
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.const import CONF_ID
-from esphome.core import CORE
+from esphome.core import CORE, coroutine_with_priority
 from esphome.components import time
 from . import const
 
+_LOGGER = logging.getLogger(__name__)
+
 CODEOWNERS = ["@fdepalo"]
 DEPENDENCIES = ["network"]  # Requires WiFi or Ethernet, not UART
 AUTO_LOAD = ["binary_sensor", "switch", "sensor", "climate", "cover", "light", "text_sensor", "number"]
@@ -44,6 +48,24 @@ def validate_knx_address(value):
         raise cv.Invalid("Invalid KNX address format")
     return f"{main}.{middle}.{sub}"
 
+def validate_physical_address(value):
+    """Validate a KNX individual address (area.line.device, e.g. 1.1.100)."""
+    value = validate_knx_address(value)
+    area, line, _ = (int(part) for part in value.split("."))
+    if area > 15 or line > 15:
+        raise cv.Invalid("Physical address area and line must be 0-15")
+    return value
+
+def group_address_to_int(address):
+    """Raw group address of a validated address: main (5 bits), middle (3), sub (8)."""
+    main, middle, sub = (int(part) for part in address.split("."))
+    return (main << 11) | (middle << 8) | sub
+
+def physical_address_to_int(address):
+    """Raw individual address of a validated address: area (4 bits), line (4), device (8)."""
+    area, line, device = (int(part) for part in address.split("."))
+    return (area << 12) | (line << 8) | device
+
 def validate_ip_address(value):
     """Validate IP address format."""
     # Simple validation - ESPHome has better validators we could use
@@ -60,9 +82,99 @@ def validate_ip_address(value):
         raise cv.Invalid("Invalid IP address format")
     return value
 
+def validate_dpt(value):
+    """Validate a DPT (e.g., 9 or 9.001) and return its main number."""
+    value = cv.string(value)
+    try:
+        main = int(value.split(".")[0])
+    except ValueError:
+        raise cv.Invalid(f"Invalid DPT: {value}")
+    if main not in const.DPT_VALUE_BITS:
+        raise cv.Invalid(f"Unsupported DPT: {value}")
+    return main
+
+def validate_dpt_id(value):
+    """Validate a DPT in the registry (e.g., 9 or 9.001) and return its normalized id."""
+    value = cv.string(value)
+    try:
+        parts = [int(part) for part in value.split(".")]
+    except ValueError:
+        raise cv.Invalid(f"Invalid DPT: {value}")
+    if len(parts) == 1:
+        dpt_id = str(parts[0])
+    elif len(parts) == 2:
+        dpt_id = f"{parts[0]}.{parts[1]:03d}"
+    else:
+        raise cv.Invalid(f"Invalid DPT: {value}")
+    if dpt_id not in const.DPT_REGISTRY:
+        raise cv.Invalid(f"Unsupported DPT: {value}")
+    return dpt_id
+
+def dpt_descriptor(dpt_id):
+    """C++ expression for the address of a registry descriptor."""
+    return cg.RawExpression(f"&{const.DOMAIN}::{const.DPT_REGISTRY[dpt_id]}")
+
+def use_group_address(ga_id, flags, value_bits=0):
+    """Record how an entity uses a group address: its flags (const.GO_LISTEN,
+    const.GO_TRANSMIT, ...) and value size go into the group object table."""
+    usage = CORE.data.setdefault(const.DOMAIN, {}).setdefault("ga_usage", {})
+    old_flags, old_bits = usage.get(ga_id.id, (0, 0))
+    if value_bits and old_bits and value_bits != old_bits:
+        _LOGGER.warning("Group address %s used with %u and %u bit values, keeping %u",
+                        ga_id.id, old_bits, value_bits, old_bits)
+    usage[ga_id.id] = (old_flags | flags, old_bits or value_bits)
+
+@coroutine_with_priority(-100.0)
+async def group_objects_to_code(var, config, extra_objects, listen_ranges):
+    """Emit the group object table once every entity has declared its group
+    addresses: sorted by address, constexpr (in flash), one entry per address."""
+    usage = CORE.data.get(const.DOMAIN, {}).get("ga_usage", {})
+    objects = {}
+
+    def add_object(ga, flags, bits):
+        old_flags, old_bits = objects.get(ga, (0, 0))
+        objects[ga] = (old_flags | flags, old_bits or bits)
+
+    for ga_config in config[const.CONF_GROUP_ADDRESSES]:
+        ga_id = ga_config[CONF_ID].id
+        flags, bits = usage.get(ga_id, (0, 0))
+        if const.CONF_DPT in ga_config:
+            dpt_bits = const.DPT_VALUE_BITS[ga_config[const.CONF_DPT]]
+            if bits and bits != dpt_bits:
+                _LOGGER.warning("Group address %s used with %u bit values, keeping %u from its dpt",
+                                ga_id, bits, dpt_bits)
+            bits = dpt_bits
+        # Declared but unused GAs can still be written from lambdas, and reach
+        # entities that use on_knx_telegram() rather than listeners
+        unused_flags = const.GO_TRANSMIT | const.GO_LISTEN
+        add_object(group_address_to_int(ga_config["address"]), flags or unused_flags, bits)
+    for ga, flags, bits in extra_objects:
+        add_object(ga, flags, bits)
+    # Objects of GAs inside an on_group_address pattern receive too
+    for ga, (flags, bits) in objects.items():
+        if any(low <= ga <= high for low, high in listen_ranges):
+            objects[ga] = (flags | const.GO_LISTEN, bits)
+    if not objects:
+        return
+
+    entries = []
+    for ga in sorted(objects):
+        flags, bits = objects[ga]
+        if bits == 0:
+            _LOGGER.warning("No value size known for GA %u/%u/%u, assuming 1 byte (set 'dpt' on the group address)",
+                            ga >> 11, (ga >> 8) & 0x07, ga & 0xFF)
+            bits = 8
+        entries.append(f"{{0x{ga:04X}, 0x{flags:02X}, {bits}}}")
+    table = f"{config[CONF_ID].id}_group_objects"
+    cg.add_global(cg.RawStatement(
+        f"static constexpr {const.DOMAIN}::GroupObjectEntry {table}[] = {{\n  " + ",\n  ".join(entries) + "\n};"
+    ))
+    cg.add(var.set_group_objects(cg.RawExpression(table), len(entries)))
+
 GROUP_ADDRESS_SCHEMA = cv.Schema({
     cv.Required(CONF_ID): cv.declare_id(GroupAddress),
     cv.Required("address"): validate_knx_address,
+    cv.Optional(const.CONF_DPT): validate_dpt,
 })
 
 CONF_TIME_ID = "time_id"
@@ -70,7 +182,7 @@ CONF_TIME_ID = "time_id"
 CONFIG_SCHEMA = cv.All(
     cv.Schema({
         cv.GenerateID(): cv.declare_id(KNXIPComponent),
-        cv.Required(const.CONF_PHYSICAL_ADDRESS): validate_knx_address,
+        cv.Required(const.CONF_PHYSICAL_ADDRESS): validate_physical_address,
         cv.Optional(const.CONF_GROUP_ADDRESSES, default=[]): cv.ensure_list(GROUP_ADDRESS_SCHEMA),
 
         # IP-specific configuration
@@ -79,9 +191,12 @@ CONFIG_SCHEMA = cv.All(
         cv.Optional(const.CONF_ROUTING_MODE, default=const.DEFAULT_ROUTING_MODE): cv.boolean,
         cv.Optional(const.CONF_MULTICAST_ADDRESS, default=const.DEFAULT_MULTICAST_ADDRESS): validate_ip_address,
 
+        # Publish coalescing: one entity update per loop for bursty GAs
+        cv.Optional(const.CONF_COALESCE_PUBLISH, default=False): cv.boolean,
+
         # Time broadcast (optional, like knx_tp)
         cv.Optional(CONF_TIME_ID): cv.use_id(time.RealTimeClock),
-        cv.Optional(const.CONF_TIME_BROADCAST_GA): cv.string,
+        cv.Optional(const.CONF_TIME_BROADCAST_GA): cv.use_id(GroupAddress),
         cv.Optional(const.CONF_TIME_BROADCAST_INTERVAL, default="60s"): cv.positive_time_period_milliseconds,
     })
     .extend(cv.COMPONENT_SCHEMA)
@@ -91,7 +206,8 @@ async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
 
-    cg.add(var.set_physical_address(config[const.CONF_PHYSICAL_ADDRESS]))
+    # Addresses are emitted as integer constants: no string parsing at boot
+    cg.add(var.set_physical_address(physical_address_to_int(config[const.CONF_PHYSICAL_ADDRESS])))
 
     # IP-specific configuration
     if const.CONF_GATEWAY_IP in config:
@@ -101,11 +217,15 @@ async def to_code(config):
     cg.add(var.set_routing_mode(config[const.CONF_ROUTING_MODE]))
     cg.add(var.set_multicast_address(config[const.CONF_MULTICAST_ADDRESS]))
 
+    if config[const.CONF_COALESCE_PUBLISH]:
+        cg.add(var.set_coalesce_publish(True))
+
     # Group addresses
-    for ga_config in config[const.CONF_GROUP_ADDRESSES]:
+    # Registered in id order: the hub keeps them sorted for get_group_address()
+    for ga_config in sorted(config[const.CONF_GROUP_ADDRESSES], key=lambda ga_config: str(ga_config[CONF_ID].id)):
         ga = cg.new_Pvariable(ga_config[CONF_ID])
         cg.add(ga.set_id(str(ga_config[CONF_ID].id)))
-        cg.add(ga.set_address(ga_config["address"]))
+        cg.add(ga.set_address(group_address_to_int(ga_config["address"])))
         cg.add(var.register_group_address(ga))
 
     # Time broadcast configuration
@@ -114,7 +234,12 @@ async def to_code(config):
         cg.add(var.set_time_source(time_component))
 
     if const.CONF_TIME_BROADCAST_GA in config:
-        cg.add(var.set_time_broadcast_ga(config[const.CONF_TIME_BROADCAST_GA]))
+        time_ga = await cg.get_variable(config[const.CONF_TIME_BROADCAST_GA])
+        cg.add(var.set_time_broadcast_ga(time_ga))
+        use_group_address(config[const.CONF_TIME_BROADCAST_GA], const.GO_TRANSMIT | const.GO_FLAG_READ, 64)
 
     if const.CONF_TIME_BROADCAST_INTERVAL in config:
         cg.add(var.set_time_broadcast_interval(config[const.CONF_TIME_BROADCAST_INTERVAL]))
+
+    # The group object table is emitted after the entity platforms ran
+    CORE.add_job(group_objects_to_code, var, config, [], [])
@@ -17,14 +17,15 @@ class KNXBinarySensor : public binary_sensor::BinarySensor, public Component, pu
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
   
-  void set_state_ga_id(const std::string &ga_id) { state_ga_id_ = ga_id; }
+  void set_state_ga(GroupAddress *ga) { state_ga_ = ga; }
   void set_invert(bool invert) { invert_ = invert; }
   void set_auto_reset_time(uint32_t time_ms) { auto_reset_time_ms_ = time_ms; }
   
-  void on_knx_telegram(const std::string &ga, const std::vector<uint8_t> &data) override;
+  void on_knx_group_value(uint8_t role, uint16_t ga, const uint8_t *data, uint8_t len) override;
+  bool uses_listeners() const override { return true; }
 
  protected:
-  std::string state_ga_id_;
+  GroupAddress *state_ga_{nullptr};
   bool invert_{false};
   uint32_t auto_reset_time_ms_{0};
   
@@ -2,7 +2,7 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import binary_sensor
 from esphome.const import CONF_ID
-from . import knx_ip_ns, KNXIPComponent, const
+from . import knx_ip_ns, KNXIPComponent, GroupAddress, use_group_address, const
 
 DEPENDENCIES = ["knx_ip"]
 
@@ -13,7 +13,7 @@ CONF_KNX_ID = "knx_id"
 CONFIG_SCHEMA = binary_sensor.binary_sensor_schema(KNXBinarySensor).extend({
     cv.GenerateID(): cv.declare_id(KNXBinarySensor),
     cv.GenerateID(CONF_KNX_ID): cv.use_id(KNXIPComponent),
-    cv.Required(const.CONF_STATE_GA): cv.string,
+    cv.Required(const.CONF_STATE_GA): cv.use_id(GroupAddress),
     cv.Optional(const.CONF_INVERT, default=False): cv.boolean,
     cv.Optional(const.CONF_AUTO_RESET_TIME): cv.positive_time_period_milliseconds,
 }).extend(cv.COMPONENT_SCHEMA)
@@ -29,7 +29,8 @@ async def to_code(config):
     cg.add(var.set_knx_component(knx))
     
     # Set the group address ID
-    cg.add(var.set_state_ga_id(config[const.CONF_STATE_GA]))
+    cg.add(var.set_state_ga(await cg.get_variable(config[const.CONF_STATE_GA])))
+    use_group_address(config[const.CONF_STATE_GA], const.GO_LISTEN, 1)
     
     # Optional parameters
     if const.CONF_INVERT in config:
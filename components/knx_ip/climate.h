@@ -15,34 +15,71 @@ class KNXClimate : public climate::Climate, public Component, public KNXEntity {
   climate::ClimateTraits traits() override;
 
   // Configuration setters
-  void set_temperature_ga_id(const std::string &ga_id) { temperature_ga_id_ = ga_id; }
-  void set_setpoint_ga_id(const std::string &ga_id) { setpoint_ga_id_ = ga_id; }
-  void set_mode_ga_id(const std::string &ga_id) { mode_ga_id_ = ga_id; }
-  void set_action_ga_id(const std::string &ga_id) { action_ga_id_ = ga_id; }
+  void set_temperature_ga(GroupAddress *ga) { temperature_ga_ = ga; }
+  void set_setpoint_ga(GroupAddress *ga) { setpoint_ga_ = ga; }
+  void set_mode_ga(GroupAddress *ga) { mode_ga_ = ga; }
+  void set_action_ga(GroupAddress *ga) { action_ga_ = ga; }
 
   // Preset GA setters
-  void set_preset_comfort_ga_id(const std::string &ga_id) { preset_comfort_ga_id_ = ga_id; }
-  void set_preset_eco_ga_id(const std::string &ga_id) { preset_eco_ga_id_ = ga_id; }
-  void set_preset_away_ga_id(const std::string &ga_id) { preset_away_ga_id_ = ga_id; }
-  void set_preset_sleep_ga_id(const std::string &ga_id) { preset_sleep_ga_id_ = ga_id; }
+  void set_preset_comfort_ga(GroupAddress *ga) { preset_comfort_ga_ = ga; }
+  void set_preset_eco_ga(GroupAddress *ga) { preset_eco_ga_ = ga; }
+  void set_preset_away_ga(GroupAddress *ga) { preset_away_ga_ = ga; }
+  void set_preset_sleep_ga(GroupAddress *ga) { preset_sleep_ga_ = ga; }
+  // Preset as one DPT 20.102 HVAC mode: preferred over the per-preset switches
+  void set_preset_mode_ga(GroupAddress *ga) { preset_mode_ga_ = ga; }
 
-  void on_knx_telegram(const std::string &ga, const std::vector<uint8_t> &data) override;
+  void on_knx_group_value(uint8_t role, uint16_t ga, const uint8_t *data, uint8_t len) override;
+  bool uses_listeners() const override { return true; }
 
  protected:
-  // Group address IDs
-  std::string temperature_ga_id_;
-  std::string setpoint_ga_id_;
-  std::string mode_ga_id_;
-  std::string action_ga_id_;
-  std::string preset_comfort_ga_id_;
-  std::string preset_eco_ga_id_;
-  std::string preset_away_ga_id_;
-  std::string preset_sleep_ga_id_;
+  // Listener roles, one per subscribed group address
+  enum Role : uint8_t {
+    ROLE_TEMPERATURE,
+    ROLE_SETPOINT,
+    ROLE_MODE,
+    ROLE_ACTION,
+    ROLE_PRESET_COMFORT,
+    ROLE_PRESET_ECO,
+    ROLE_PRESET_AWAY,
+    ROLE_PRESET_SLEEP,
+    ROLE_PRESET_MODE,
+  };
+
+  // Preset switch slots, in the order of preset_states_
+  enum PresetSlot : uint8_t {
+    SLOT_COMFORT,
+    SLOT_ECO,
+    SLOT_AWAY,
+    SLOT_SLEEP,
+    SLOT_COUNT,
+  };
+  static constexpr int8_t UNKNOWN = -1;
+
+  // Group addresses (nullptr = not configured)
+  GroupAddress *temperature_ga_{nullptr};
+  GroupAddress *setpoint_ga_{nullptr};
+  GroupAddress *mode_ga_{nullptr};
+  GroupAddress *action_ga_{nullptr};
+  GroupAddress *preset_comfort_ga_{nullptr};
+  GroupAddress *preset_eco_ga_{nullptr};
+  GroupAddress *preset_away_ga_{nullptr};
+  GroupAddress *preset_sleep_ga_{nullptr};
+  GroupAddress *preset_mode_ga_{nullptr};
+
+  // Last known bus state of what we send, from our writes and from feedback:
+  // only the telegrams that change it go out (UNKNOWN = always send)
+  int8_t preset_states_[SLOT_COUNT]{UNKNOWN, UNKNOWN, UNKNOWN, UNKNOWN};
+  int16_t last_hvac_mode_{UNKNOWN};
+  int16_t last_preset_mode_{UNKNOWN};
 
   // Helper methods
   void send_temperature_(float temp);
   void send_mode_(climate::ClimateMode mode);
   void send_preset_(climate::ClimatePreset preset);
+  void on_preset_feedback_(PresetSlot slot, climate::ClimatePreset preset_type, const uint8_t *data, uint8_t len);
+  GroupAddress *preset_slot_ga_(uint8_t slot) const;
+  static uint8_t preset_to_hvac_mode_(climate::ClimatePreset preset);
+  static climate::ClimatePreset hvac_mode_to_preset_(uint8_t hvac_mode);
   climate::ClimateMode hvac_mode_to_climate_mode_(uint8_t hvac_mode);
   uint8_t climate_mode_to_hvac_mode_(climate::ClimateMode mode);
 };
@@ -2,7 +2,7 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import climate
 from esphome.const import CONF_ID
-from . import knx_ip_ns, KNXIPComponent, const
+from . import knx_ip_ns, KNXIPComponent, GroupAddress, use_group_address, const
 
 DEPENDENCIES = ["knx_ip"]
 KNXClimate = knx_ip_ns.class_("KNXClimate", climate.Climate, cg.Component)
@@ -10,14 +10,15 @@ KNXClimate = knx_ip_ns.class_("KNXClimate", climate.Climate, cg.Component)
 CONFIG_SCHEMA = climate.climate_schema(KNXClimate).extend({
     cv.GenerateID(): cv.declare_id(KNXClimate),
     cv.GenerateID("knx_id"): cv.use_id(KNXIPComponent),
-    cv.Required(const.CONF_TEMPERATURE_GA): cv.string,
-    cv.Required(const.CONF_SETPOINT_GA): cv.string,
-    cv.Optional(const.CONF_MODE_GA): cv.string,
-    cv.Optional(const.CONF_ACTION_GA): cv.string,
-    cv.Optional(const.CONF_PRESET_COMFORT_GA): cv.string,
-    cv.Optional(const.CONF_PRESET_ECO_GA): cv.string,
-    cv.Optional(const.CONF_PRESET_AWAY_GA): cv.string,
-    cv.Optional(const.CONF_PRESET_SLEEP_GA): cv.string,
+    cv.Required(const.CONF_TEMPERATURE_GA): cv.use_id(GroupAddress),
+    cv.Required(const.CONF_SETPOINT_GA): cv.use_id(GroupAddress),
+    cv.Optional(const.CONF_MODE_GA): cv.use_id(GroupAddress),
+    cv.Optional(const.CONF_ACTION_GA): cv.use_id(GroupAddress),
+    cv.Optional(const.CONF_PRESET_COMFORT_GA): cv.use_id(GroupAddress),
+    cv.Optional(const.CONF_PRESET_ECO_GA): cv.use_id(GroupAddress),
+    cv.Optional(const.CONF_PRESET_AWAY_GA): cv.use_id(GroupAddress),
+    cv.Optional(const.CONF_PRESET_SLEEP_GA): cv.use_id(GroupAddress),
+    cv.Optional(const.CONF_PRESET_MODE_GA): cv.use_id(GroupAddress),
 }).extend(cv.COMPONENT_SCHEMA)
 
 async def to_code(config):
@@ -26,17 +27,28 @@ async def to_code(config):
     await climate.register_climate(var, config)
     knx = await cg.get_variable(config["knx_id"])
     cg.add(var.set_knx_component(knx))
-    cg.add(var.set_temperature_ga_id(config[const.CONF_TEMPERATURE_GA]))
-    cg.add(var.set_setpoint_ga_id(config[const.CONF_SETPOINT_GA]))
+    cg.add(var.set_temperature_ga(await cg.get_variable(config[const.CONF_TEMPERATURE_GA])))
+    use_group_address(config[const.CONF_TEMPERATURE_GA], const.GO_LISTEN, 16)
+    cg.add(var.set_setpoint_ga(await cg.get_variable(config[const.CONF_SETPOINT_GA])))
+    use_group_address(config[const.CONF_SETPOINT_GA], const.GO_LISTEN | const.GO_TRANSMIT, 16)
     if const.CONF_MODE_GA in config:
-        cg.add(var.set_mode_ga_id(config[const.CONF_MODE_GA]))
+        cg.add(var.set_mode_ga(await cg.get_variable(config[const.CONF_MODE_GA])))
+        use_group_address(config[const.CONF_MODE_GA], const.GO_LISTEN | const.GO_TRANSMIT, 8)
     if const.CONF_ACTION_GA in config:
-        cg.add(var.set_action_ga_id(config[const.CONF_ACTION_GA]))
+        cg.add(var.set_action_ga(await cg.get_variable(config[const.CONF_ACTION_GA])))
+        use_group_address(config[const.CONF_ACTION_GA], const.GO_LISTEN, 1)
     if const.CONF_PRESET_COMFORT_GA in config:
-        cg.add(var.set_preset_comfort_ga_id(config[const.CONF_PRESET_COMFORT_GA]))
+        cg.add(var.set_preset_comfort_ga(await cg.get_variable(config[const.CONF_PRESET_COMFORT_GA])))
+        use_group_address(config[const.CONF_PRESET_COMFORT_GA], const.GO_LISTEN | const.GO_TRANSMIT, 1)
     if const.CONF_PRESET_ECO_GA in config:
-        cg.add(var.set_preset_eco_ga_id(config[const.CONF_PRESET_ECO_GA]))
+        cg.add(var.set_preset_eco_ga(await cg.get_variable(config[const.CONF_PRESET_ECO_GA])))
+        use_group_address(config[const.CONF_PRESET_ECO_GA], const.GO_LISTEN | const.GO_TRANSMIT, 1)
     if const.CONF_PRESET_AWAY_GA in config:
-        cg.add(var.set_preset_away_ga_id(config[const.CONF_PRESET_AWAY_GA]))
+        cg.add(var.set_preset_away_ga(await cg.get_variable(config[const.CONF_PRESET_AWAY_GA])))
+        use_group_address(config[const.CONF_PRESET_AWAY_GA], const.GO_LISTEN | const.GO_TRANSMIT, 1)
     if const.CONF_PRESET_SLEEP_GA in config:
-        cg.add(var.set_preset_sleep_ga_id(config[const.CONF_PRESET_SLEEP_GA]))
+        cg.add(var.set_preset_sleep_ga(await cg.get_variable(config[const.CONF_PRESET_SLEEP_GA])))
+        use_group_address(config[const.CONF_PRESET_SLEEP_GA], const.GO_LISTEN | const.GO_TRANSMIT, 1)
+    if const.CONF_PRESET_MODE_GA in config:
+        cg.add(var.set_preset_mode_ga(await cg.get_variable(config[const.CONF_PRESET_MODE_GA])))
+        use_group_address(config[const.CONF_PRESET_MODE_GA], const.GO_LISTEN | const.GO_TRANSMIT, 8)
\ No newline at end of file
@@ -15,16 +15,30 @@ CONF_PRESET_COMFORT_GA = "preset_comfort_ga"
 CONF_PRESET_ECO_GA = "preset_eco_ga"
 CONF_PRESET_AWAY_GA = "preset_away_ga"
 CONF_PRESET_SLEEP_GA = "preset_sleep_ga"
+CONF_PRESET_MODE_GA = "preset_mode_ga"
 CONF_POSITION_GA = "position_ga"
 CONF_MOVE_GA = "move_ga"
 CONF_STOP_GA = "stop_ga"
 CONF_BRIGHTNESS_GA = "brightness_ga"
 CONF_SWITCH_GA = "switch_ga"
+CONF_MAX_RATE = "max_rate"
+CONF_BRIGHTNESS_STATE_GA = "brightness_state_ga"
+CONF_DIMMING_GA = "dimming_ga"
+CONF_TRANSITION_MODE = "transition_mode"
+CONF_COLOR_GA = "color_ga"
+CONF_COLOR_STATE_GA = "color_state_ga"
+CONF_COLOR_DPT = "color_dpt"
 CONF_INVERT = "invert"
 CONF_AUTO_RESET_TIME = "auto_reset_time"
 CONF_DPT_TYPE = "dpt_type"
+CONF_DPT = "dpt"
+CONF_DEADBAND = "deadband"
+CONF_DEADBAND_PERCENT = "deadband_percent"
+CONF_MIN_INTERVAL = "min_interval"
+CONF_MAX_INTERVAL = "max_interval"
 CONF_TIME_BROADCAST_GA = "time_broadcast_ga"
 CONF_TIME_BROADCAST_INTERVAL = "time_broadcast_interval"
+CONF_COALESCE_PUBLISH = "coalesce_publish"
 
 # IP-specific configuration
 CONF_GATEWAY_IP = "gateway_ip"
@@ -37,6 +51,16 @@ DEFAULT_GATEWAY_PORT = 3671
 DEFAULT_MULTICAST_ADDRESS = "224.0.23.12"
 DEFAULT_ROUTING_MODE = True  # True = routing (multicast), False = tunneling
 
+# Group object flags (GroupObjectFlag in group_address.h)
+GO_FLAG_COMMUNICATION = 1 << 0
+GO_FLAG_READ = 1 << 1
+GO_FLAG_WRITE = 1 << 2
+GO_FLAG_TRANSMIT = 1 << 3
+GO_FLAG_UPDATE = 1 << 4
+# How an entity uses a group address: listeners receive it, transmitters send on it
+GO_LISTEN = GO_FLAG_COMMUNICATION | GO_FLAG_WRITE | GO_FLAG_UPDATE
+GO_TRANSMIT = GO_FLAG_COMMUNICATION | GO_FLAG_TRANSMIT
+
 # DPT Types
 DPT_1_001 = "1.001"  # Boolean
 DPT_5_001 = "5.001"  # Unsigned 8-bit (0-255)
@@ -45,3 +69,113 @@ DPT_9_001 = "9.001"  # Temperature (°C)
 DPT_9_004 = "9.004"  # Illuminance (lux)
 DPT_9_007 = "9.007"  # Humidity (%)
 DPT_16_001 = "16.001"  # Character string
+
+# Group object value size in bits, by DPT main number (for the "dpt" option
+# of group addresses that no entity sizes, e.g. ones only used by triggers)
+DPT_VALUE_BITS = {
+    1: 1, 2: 2, 3: 4, 4: 8, 5: 8, 6: 8, 7: 16, 8: 16, 9: 16, 10: 24, 11: 24,
+    12: 32, 13: 32, 14: 32, 16: 112, 17: 8, 18: 8, 19: 64, 20: 8, 232: 24, 251: 48,
+}
+
+# Descriptors of dpt_registry.h by DPT id ("main.sub", or the main number alone
+# for the main type): keep in sync with the C++ registry
+DPT_REGISTRY = {
+    "1": "DPT_1",
+    "1.001": "DPT_1_001",
+    "1.002": "DPT_1_002",
+    "1.003": "DPT_1_003",
+    "1.005": "DPT_1_005",
+    "1.007": "DPT_1_007",
+    "1.008": "DPT_1_008",
+    "1.009": "DPT_1_009",
+    "1.010": "DPT_1_010",
+    "5": "DPT_5",
+    "5.001": "DPT_5_001",
+    "5.003": "DPT_5_003",
+    "5.004": "DPT_5_004",
+    "5.010": "DPT_5_010",
+    "6": "DPT_6",
+    "6.001": "DPT_6_001",
+    "6.010": "DPT_6_010",
+    "7": "DPT_7",
+    "7.001": "DPT_7_001",
+    "7.002": "DPT_7_002",
+    "7.003": "DPT_7_003",
+    "7.004": "DPT_7_004",
+    "7.005": "DPT_7_005",
+    "7.006": "DPT_7_006",
+    "7.007": "DPT_7_007",
+    "7.011": "DPT_7_011",
+    "7.012": "DPT_7_012",
+    "7.013": "DPT_7_013",
+    "7.600": "DPT_7_600",
+    "8": "DPT_8",
+    "8.001": "DPT_8_001",
+    "8.002": "DPT_8_002",
+    "8.003": "DPT_8_003",
+    "8.004": "DPT_8_004",
+    "8.005": "DPT_8_005",
+    "8.006": "DPT_8_006",
+    "8.007": "DPT_8_007",
+    "8.010": "DPT_8_010",
+    "8.011": "DPT_8_011",
+    "9": "DPT_9",
+    "9.001": "DPT_9_001",
+    "9.002": "DPT_9_002",
+    "9.003": "DPT_9_003",
+    "9.004": "DPT_9_004",
+    "9.005": "DPT_9_005",
+    "9.006": "DPT_9_006",
+    "9.007": "DPT_9_007",
+    "9.008": "DPT_9_008",
+    "9.010": "DPT_9_010",
+    "9.011": "DPT_9_011",
+    "9.020": "DPT_9_020",
+    "9.021": "DPT_9_021",
+    "9.024": "DPT_9_024",
+    "9.025": "DPT_9_025",
+    "9.026": "DPT_9_026",
+    "9.027": "DPT_9_027",
+    "9.028": "DPT_9_028",
+    "9.029": "DPT_9_029",
+    "9.030": "DPT_9_030",
+    "12": "DPT_12",
+    "12.001": "DPT_12_001",
+    "12.100": "DPT_12_100",
+    "12.101": "DPT_12_101",
+    "12.102": "DPT_12_102",
+    "12.1200": "DPT_12_1200",
+    "12.1201": "DPT_12_1201",
+    "13": "DPT_13",
+    "13.001": "DPT_13_001",
+    "13.002": "DPT_13_002",
+    "13.010": "DPT_13_010",
+    "13.011": "DPT_13_011",
+    "13.012": "DPT_13_012",
+    "13.013": "DPT_13_013",
+    "13.014": "DPT_13_014",
+    "13.015": "DPT_13_015",
+    "13.100": "DPT_13_100",
+    "14": "DPT_14",
+    "14.007": "DPT_14_007",
+    "14.017": "DPT_14_017",
+    "14.019": "DPT_14_019",
+    "14.027": "DPT_14_027",
+    "14.031": "DPT_14_031",
+    "14.033": "DPT_14_033",
+    "14.039": "DPT_14_039",
+    "14.051": "DPT_14_051",
+    "14.056": "DPT_14_056",
+    "14.057": "DPT_14_057",
+    "14.065": "DPT_14_065",
+    "14.068": "DPT_14_068",
+    "14.076": "DPT_14_076",
+    "17.001": "DPT_17_001",
+    "18.001": "DPT_18_001",
+    "20.102": "DPT_20_102",
+    "232.600": "DPT_232_600",
+    "251.600": "DPT_251_600",
+}
+
+# Colour DPTs: no scalar value, only for lights
+DPT_COLOR = {"232.600", "251.600"}
@@ -1,27 +1,122 @@
 #include "cover.h"
 #include "dpt.h"
 #include "esphome/core/log.h"
+#include <algorithm>
+#include <cmath>
 namespace esphome { namespace knx_ip {
 static constexpr const char* TAG = "knx_ip.cover";
-void KNXCover::setup() { if (knx_) knx_->register_entity(this); }
+// Publish rate of the estimated position while moving
+static constexpr uint32_t ESTIMATE_PUBLISH_INTERVAL_MS = 1000;
+// Positions closer than this are the same (DPT 5.001 steps are ~0.4%)
+static constexpr float POSITION_TOLERANCE = 0.01f;
+static bool same_position(float a, float b) { return std::abs(a - b) < POSITION_TOLERANCE; }
+static bool is_end_position(float p) {
+  return same_position(p, cover::COVER_OPEN) || same_position(p, cover::COVER_CLOSED);
+}
+void KNXCover::setup() {
+  auto restore = restore_state_();
+  if (restore.has_value()) restore->apply(this);
+  if (knx_) {
+    knx_->register_entity(this);
+    if (position_ga_) knx_->register_listener(position_ga_, this, 0);
+  }
+}
 cover::CoverTraits KNXCover::get_traits() {
   auto t = cover::CoverTraits();
   t.set_supports_stop(true);
-  t.set_supports_position(!position_ga_id_.empty());
+  t.set_supports_position(position_ga_ != nullptr || has_estimate_());
   return t;
 }
 void KNXCover::control(const cover::CoverCall &call) {
-  if (call.get_position().has_value() && knx_ && !position_ga_id_.empty()) {
-    position = *call.get_position();
-    knx_->send_group_write(position_ga_id_, DPT::encode_dpt5_percentage(position * 100.0f));
+  if (!knx_) return;
+  if (call.get_stop()) {
+    stop_move_();
+    return;
+  }
+  if (!call.get_position().has_value()) return;
+  float target = *call.get_position();
+  // End positions always go out as a move, even when the estimate says the cover is there:
+  // the actuator stops at its end switch, which also resyncs an estimate a wall switch threw off
+  bool end_target = is_end_position(target);
+  if (end_target) target = target >= 0.5f ? cover::COVER_OPEN : cover::COVER_CLOSED;
+  if (has_estimate_()) {
+    update_estimate_(millis());
+    if (!end_target && same_position(target, position)) {
+      // Already there: nothing to move, only a move in progress to stop
+      if (current_operation != cover::COVER_OPERATION_IDLE) stop_move_();
+      return;
+    }
+  }
+  // Opening or closing: from the target for end positions and without an estimate (the
+  // position is then just the last command), from the estimate otherwise
+  bool opening = end_target || !has_estimate_() ? target >= 0.5f : target > position;
+  if (position_ga_ && !end_target) {
+    // The actuator positions itself; the estimate only animates the way there
+    knx_->send_group_write(position_ga_->get_address_int(), DPT::encode_dpt5_percentage_fixed(target * 100.0f));
+  } else {
+    // DPT 1.008: 0 = up (open), 1 = down (close)
+    knx_->send_group_write(move_ga_->get_address_int(), DPT::encode_dpt1_fixed(!opening));
+  }
+  if (!has_estimate_()) {
+    position = target;
+    publish_state();
+    return;
   }
+  start_move_(opening ? cover::COVER_OPERATION_OPENING : cover::COVER_OPERATION_CLOSING, target);
+}
+void KNXCover::start_move_(cover::CoverOperation operation, float target) {
+  move_start_time_ = last_publish_time_ = millis();
+  move_start_position_ = position;
+  target_position_ = target;
+  current_operation = operation;
+  publish_state();
+}
+void KNXCover::stop_move_() {
+  if (has_estimate_()) update_estimate_(millis());
+  // DPT 1.007: a step telegram stops a moving actuator
+  if (stop_ga_) knx_->send_group_write(stop_ga_->get_address_int(), DPT::encode_dpt1_fixed(true));
+  else ESP_LOGW(TAG, "'%s': no stop_ga, cannot stop", get_name().c_str());
+  current_operation = cover::COVER_OPERATION_IDLE;
   publish_state();
 }
-void KNXCover::on_knx_telegram(const std::string &ga, const std::vector<uint8_t> &data) {
-  auto pos_ga = knx_->get_group_address(position_ga_id_);
-  if (pos_ga && pos_ga->get_address() == ga) {
-    position = DPT::decode_dpt5_percentage(data) / 100.0f;
+void KNXCover::update_estimate_(uint32_t now) {
+  if (current_operation == cover::COVER_OPERATION_IDLE) return;
+  // Linear travel: a full close or open takes its configured duration
+  bool opening = current_operation == cover::COVER_OPERATION_OPENING;
+  float travelled = static_cast<float>(now - move_start_time_) / (opening ? open_duration_ : close_duration_);
+  position = std::min(std::max(move_start_position_ + (opening ? travelled : -travelled), 0.0f), 1.0f);
+}
+void KNXCover::loop() {
+  if (current_operation == cover::COVER_OPERATION_IDLE || !has_estimate_()) return;
+  uint32_t now = millis();
+  update_estimate_(now);
+  bool opening = current_operation == cover::COVER_OPERATION_OPENING;
+  if (opening ? position >= target_position_ : position <= target_position_) {
+    position = target_position_;
+    // End positions and positions sent on position_ga stop by themselves; a move_ga move to a
+    // middle position needs the stop telegram
+    bool self_stopping = is_end_position(target_position_) || position_ga_ != nullptr;
+    if (!self_stopping) {
+      stop_move_();
+      return;
+    }
+    current_operation = cover::COVER_OPERATION_IDLE;
     publish_state();
+  } else if (now - last_publish_time_ >= ESTIMATE_PUBLISH_INTERVAL_MS) {
+    last_publish_time_ = now;
+    publish_state(false);
   }
 }
-}}
\ No newline at end of file
+void KNXCover::on_knx_group_value(uint8_t role, uint16_t ga, const uint8_t *data, uint8_t len) {
+  // Actuator status is authoritative: it replaces the estimate and ends a move that arrived
+  position = DPT::decode_dpt5_percentage(data, len) / 100.0f;
+  if (current_operation != cover::COVER_OPERATION_IDLE && same_position(position, target_position_)) {
+    current_operation = cover::COVER_OPERATION_IDLE;
+  } else if (current_operation != cover::COVER_OPERATION_IDLE) {
+    // Still on its way: carry on estimating from the reported position
+    move_start_time_ = millis();
+    move_start_position_ = position;
+  }
+  publish_state();
+}
+}}
@@ -6,13 +6,26 @@ namespace esphome { namespace knx_ip {
 class KNXCover : public cover::Cover, public Component, public KNXEntity {
  public:
   void setup() override;
+  void loop() override;
   cover::CoverTraits get_traits() override;
-  void set_move_ga_id(const std::string &ga_id) { move_ga_id_ = ga_id; }
-  void set_position_ga_id(const std::string &ga_id) { position_ga_id_ = ga_id; }
-  void set_stop_ga_id(const std::string &ga_id) { stop_ga_id_ = ga_id; }
-  void on_knx_telegram(const std::string &ga, const std::vector<uint8_t> &data) override;
+  void set_move_ga(GroupAddress *ga) { move_ga_ = ga; }
+  void set_position_ga(GroupAddress *ga) { position_ga_ = ga; }
+  void set_stop_ga(GroupAddress *ga) { stop_ga_ = ga; }
+  // Full travel times: enable the local position estimate (0 = unknown)
+  void set_open_duration(uint32_t ms) { open_duration_ = ms; }
+  void set_close_duration(uint32_t ms) { close_duration_ = ms; }
+  void on_knx_group_value(uint8_t role, uint16_t ga, const uint8_t *data, uint8_t len) override;
+  bool uses_listeners() const override { return true; }
  protected:
   void control(const cover::CoverCall &call) override;
-  std::string move_ga_id_, position_ga_id_, stop_ga_id_;
+  bool has_estimate_() const { return open_duration_ > 0 && close_duration_ > 0; }
+  void start_move_(cover::CoverOperation operation, float target);
+  void stop_move_();
+  void update_estimate_(uint32_t now);
+  GroupAddress *move_ga_{nullptr}, *position_ga_{nullptr}, *stop_ga_{nullptr};
+  uint32_t open_duration_{0}, close_duration_{0};
+  // Estimator: where the move started, when, and where it should end
+  uint32_t move_start_time_{0}, last_publish_time_{0};
+  float move_start_position_{0}, target_position_{0};
 };
-}}
\ No newline at end of file
+}}
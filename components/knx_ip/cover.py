@@ -1,16 +1,19 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import cover
-from esphome.const import CONF_ID
-from . import knx_ip_ns, KNXIPComponent, const
+from esphome.const import CONF_ID, CONF_OPEN_DURATION, CONF_CLOSE_DURATION
+from . import knx_ip_ns, KNXIPComponent, GroupAddress, use_group_address, const
 DEPENDENCIES = ["knx_ip"]
 KNXCover = knx_ip_ns.class_("KNXCover", cover.Cover, cg.Component)
 CONFIG_SCHEMA = cover.cover_schema(KNXCover).extend({
     cv.GenerateID(): cv.declare_id(KNXCover),
     cv.GenerateID("knx_id"): cv.use_id(KNXIPComponent),
-    cv.Required(const.CONF_MOVE_GA): cv.string,
-    cv.Optional(const.CONF_POSITION_GA): cv.string,
-    cv.Optional(const.CONF_STOP_GA): cv.string,
+    cv.Required(const.CONF_MOVE_GA): cv.use_id(GroupAddress),
+    cv.Optional(const.CONF_POSITION_GA): cv.use_id(GroupAddress),
+    cv.Optional(const.CONF_STOP_GA): cv.use_id(GroupAddress),
+    # Full travel times: the position is estimated locally while the cover moves
+    cv.Inclusive(CONF_OPEN_DURATION, "travel_time"): cv.positive_time_period_milliseconds,
+    cv.Inclusive(CONF_CLOSE_DURATION, "travel_time"): cv.positive_time_period_milliseconds,
 }).extend(cv.COMPONENT_SCHEMA)
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
@@ -18,6 +21,14 @@ async def to_code(config):
     await cover.register_cover(var, config)
     knx = await cg.get_variable(config["knx_id"])
     cg.add(var.set_knx_component(knx))
-    cg.add(var.set_move_ga_id(config[const.CONF_MOVE_GA]))
-    if const.CONF_POSITION_GA in config: cg.add(var.set_position_ga_id(config[const.CONF_POSITION_GA]))
-    if const.CONF_STOP_GA in config: cg.add(var.set_stop_ga_id(config[const.CONF_STOP_GA]))
\ No newline at end of file
+    cg.add(var.set_move_ga(await cg.get_variable(config[const.CONF_MOVE_GA])))
+    use_group_address(config[const.CONF_MOVE_GA], const.GO_TRANSMIT, 1)
+    if const.CONF_POSITION_GA in config:
+        cg.add(var.set_position_ga(await cg.get_variable(config[const.CONF_POSITION_GA])))
+        use_group_address(config[const.CONF_POSITION_GA], const.GO_LISTEN | const.GO_TRANSMIT, 8)
+    if const.CONF_STOP_GA in config:
+        cg.add(var.set_stop_ga(await cg.get_variable(config[const.CONF_STOP_GA])))
+        use_group_address(config[const.CONF_STOP_GA], const.GO_TRANSMIT, 1)
+    if CONF_OPEN_DURATION in config:
+        cg.add(var.set_open_duration(config[CONF_OPEN_DURATION]))
+        cg.add(var.set_close_duration(config[CONF_CLOSE_DURATION]))
\ No newline at end of file
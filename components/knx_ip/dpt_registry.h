@@ -0,0 +1,336 @@
+#pragma once
+
+#include "dpt.h"
+
+namespace esphome {
+namespace knx_ip {
+
+/**
+ * Registry of the datapoint types handled by the generic codecs
+ * (DPT::decode, DPT::decode_centi, DPT::encode, DPT::decode_color/encode_color)
+ *
+ * Descriptors are inline constexpr: code generation references the ones a
+ * configuration uses (e.g. &DPT_9_001) and the others never reach flash.
+ * The Python side mirrors this list in const.py (DPT_REGISTRY): keep both in sync.
+ * Adding a type of an existing family is one line here and one there.
+ */
+
+// 1.xxx - Boolean
+inline constexpr DPTDescriptor DPT_1{1, 0, DPTFamily::BOOLEAN, 1, 1, 1, 0.0f, 1.0f, ""};
+// 1.001 - Switch
+inline constexpr DPTDescriptor DPT_1_001{1, 1, DPTFamily::BOOLEAN, 1, 1, 1, 0.0f, 1.0f, ""};
+// 1.002 - Bool
+inline constexpr DPTDescriptor DPT_1_002{1, 2, DPTFamily::BOOLEAN, 1, 1, 1, 0.0f, 1.0f, ""};
+// 1.003 - Enable
+inline constexpr DPTDescriptor DPT_1_003{1, 3, DPTFamily::BOOLEAN, 1, 1, 1, 0.0f, 1.0f, ""};
+// 1.005 - Alarm
+inline constexpr DPTDescriptor DPT_1_005{1, 5, DPTFamily::BOOLEAN, 1, 1, 1, 0.0f, 1.0f, ""};
+// 1.007 - Step
+inline constexpr DPTDescriptor DPT_1_007{1, 7, DPTFamily::BOOLEAN, 1, 1, 1, 0.0f, 1.0f, ""};
+// 1.008 - Up/Down
+inline constexpr DPTDescriptor DPT_1_008{1, 8, DPTFamily::BOOLEAN, 1, 1, 1, 0.0f, 1.0f, ""};
+// 1.009 - Open/Close
+inline constexpr DPTDescriptor DPT_1_009{1, 9, DPTFamily::BOOLEAN, 1, 1, 1, 0.0f, 1.0f, ""};
+// 1.010 - Start
+inline constexpr DPTDescriptor DPT_1_010{1, 10, DPTFamily::BOOLEAN, 1, 1, 1, 0.0f, 1.0f, ""};
+
+// 5.xxx - 8-bit unsigned
+inline constexpr DPTDescriptor DPT_5{5, 0, DPTFamily::UNSIGNED, 8, 1, 1, 0.0f, 255.0f, ""};
+// 5.001 - Scaling
+inline constexpr DPTDescriptor DPT_5_001{5, 1, DPTFamily::UNSIGNED, 8, 100, 255, 0.0f, 100.0f, "%"};
+// 5.003 - Angle
+inline constexpr DPTDescriptor DPT_5_003{5, 3, DPTFamily::UNSIGNED, 8, 360, 255, 0.0f, 360.0f, "°"};
+// 5.004 - Percent 0-255
+inline constexpr DPTDescriptor DPT_5_004{5, 4, DPTFamily::UNSIGNED, 8, 1, 1, 0.0f, 255.0f, "%"};
+// 5.010 - Counter
+inline constexpr DPTDescriptor DPT_5_010{5, 10, DPTFamily::UNSIGNED, 8, 1, 1, 0.0f, 255.0f, "pulses"};
+
+// 6.xxx - 8-bit signed
+inline constexpr DPTDescriptor DPT_6{6, 0, DPTFamily::SIGNED, 8, 1, 1, -128.0f, 127.0f, ""};
+// 6.001 - Percent
+inline constexpr DPTDescriptor DPT_6_001{6, 1, DPTFamily::SIGNED, 8, 1, 1, -128.0f, 127.0f, "%"};
+// 6.010 - Counter
+inline constexpr DPTDescriptor DPT_6_010{6, 10, DPTFamily::SIGNED, 8, 1, 1, -128.0f, 127.0f, "pulses"};
+
+// 7.xxx - 2-byte unsigned
+inline constexpr DPTDescriptor DPT_7{7, 0, DPTFamily::UNSIGNED, 16, 1, 1, 0.0f, 65535.0f, ""};
+// 7.001 - Pulses
+inline constexpr DPTDescriptor DPT_7_001{7, 1, DPTFamily::UNSIGNED, 16, 1, 1, 0.0f, 65535.0f, "pulses"};
+// 7.002 - Time period
+inline constexpr DPTDescriptor DPT_7_002{7, 2, DPTFamily::UNSIGNED, 16, 1, 1, 0.0f, 65535.0f, "ms"};
+// 7.003 - Time period (10 ms)
+inline constexpr DPTDescriptor DPT_7_003{7, 3, DPTFamily::UNSIGNED, 16, 10, 1, 0.0f, 655350.0f, "ms"};
+// 7.004 - Time period (100 ms)
+inline constexpr DPTDescriptor DPT_7_004{7, 4, DPTFamily::UNSIGNED, 16, 100, 1, 0.0f, 6553500.0f, "ms"};
+// 7.005 - Time period (s)
+inline constexpr DPTDescriptor DPT_7_005{7, 5, DPTFamily::UNSIGNED, 16, 1, 1, 0.0f, 65535.0f, "s"};
+// 7.006 - Time period (min)
+inline constexpr DPTDescriptor DPT_7_006{7, 6, DPTFamily::UNSIGNED, 16, 1, 1, 0.0f, 65535.0f, "min"};
+// 7.007 - Time period (h)
+inline constexpr DPTDescriptor DPT_7_007{7, 7, DPTFamily::UNSIGNED, 16, 1, 1, 0.0f, 65535.0f, "h"};
+// 7.011 - Length
+inline constexpr DPTDescriptor DPT_7_011{7, 11, DPTFamily::UNSIGNED, 16, 1, 1, 0.0f, 65535.0f, "mm"};
+// 7.012 - Current
+inline constexpr DPTDescriptor DPT_7_012{7, 12, DPTFamily::UNSIGNED, 16, 1, 1, 0.0f, 65535.0f, "mA"};
+// 7.013 - Brightness
+inline constexpr DPTDescriptor DPT_7_013{7, 13, DPTFamily::UNSIGNED, 16, 1, 1, 0.0f, 65535.0f, "lx"};
+// 7.600 - Colour temperature
+inline constexpr DPTDescriptor DPT_7_600{7, 600, DPTFamily::UNSIGNED, 16, 1, 1, 0.0f, 65535.0f, "K"};
+
+// 8.xxx - 2-byte signed
+inline constexpr DPTDescriptor DPT_8{8, 0, DPTFamily::SIGNED, 16, 1, 1, -32768.0f, 32767.0f, ""};
+// 8.001 - Pulses difference
+inline constexpr DPTDescriptor DPT_8_001{8, 1, DPTFamily::SIGNED, 16, 1, 1, -32768.0f, 32767.0f, "pulses"};
+// 8.002 - Time lag
+inline constexpr DPTDescriptor DPT_8_002{8, 2, DPTFamily::SIGNED, 16, 1, 1, -32768.0f, 32767.0f, "ms"};
+// 8.003 - Time lag (10 ms)
+inline constexpr DPTDescriptor DPT_8_003{8, 3, DPTFamily::SIGNED, 16, 10, 1, -327680.0f, 327670.0f, "ms"};
+// 8.004 - Time lag (100 ms)
+inline constexpr DPTDescriptor DPT_8_004{8, 4, DPTFamily::SIGNED, 16, 100, 1, -3276800.0f, 3276700.0f, "ms"};
+// 8.005 - Time lag (s)
+inline constexpr DPTDescriptor DPT_8_005{8, 5, DPTFamily::SIGNED, 16, 1, 1, -32768.0f, 32767.0f, "s"};
+// 8.006 - Time lag (min)
+inline constexpr DPTDescriptor DPT_8_006{8, 6, DPTFamily::SIGNED, 16, 1, 1, -32768.0f, 32767.0f, "min"};
+// 8.007 - Time lag (h)
+inline constexpr DPTDescriptor DPT_8_007{8, 7, DPTFamily::SIGNED, 16, 1, 1, -32768.0f, 32767.0f, "h"};
+// 8.010 - Percent difference
+inline constexpr DPTDescriptor DPT_8_010{8, 10, DPTFamily::SIGNED, 16, 1, 100, -327.68f, 327.67f, "%"};
+// 8.011 - Rotation angle
+inline constexpr DPTDescriptor DPT_8_011{8, 11, DPTFamily::SIGNED, 16, 1, 1, -32768.0f, 32767.0f, "°"};
+
+// 9.xxx - 2-byte float
+inline constexpr DPTDescriptor DPT_9{9, 0, DPTFamily::FLOAT16, 16, 1, 1, -671088.64f, 670760.96f, ""};
+// 9.001 - Temperature
+inline constexpr DPTDescriptor DPT_9_001{9, 1, DPTFamily::FLOAT16, 16, 1, 1, -273.0f, 670760.96f, "°C"};
+// 9.002 - Temperature difference
+inline constexpr DPTDescriptor DPT_9_002{9, 2, DPTFamily::FLOAT16, 16, 1, 1, -670760.0f, 670760.0f, "K"};
+// 9.003 - Kelvin per hour
+inline constexpr DPTDescriptor DPT_9_003{9, 3, DPTFamily::FLOAT16, 16, 1, 1, -670760.0f, 670760.0f, "K/h"};
+// 9.004 - Illuminance
+inline constexpr DPTDescriptor DPT_9_004{9, 4, DPTFamily::FLOAT16, 16, 1, 1, 0.0f, 670760.96f, "lx"};
+// 9.005 - Wind speed
+inline constexpr DPTDescriptor DPT_9_005{9, 5, DPTFamily::FLOAT16, 16, 1, 1, 0.0f, 670760.96f, "m/s"};
+// 9.006 - Pressure
+inline constexpr DPTDescriptor DPT_9_006{9, 6, DPTFamily::FLOAT16, 16, 1, 1, 0.0f, 670760.96f, "Pa"};
+// 9.007 - Humidity
+inline constexpr DPTDescriptor DPT_9_007{9, 7, DPTFamily::FLOAT16, 16, 1, 1, 0.0f, 670760.96f, "%"};
+// 9.008 - Air quality
+inline constexpr DPTDescriptor DPT_9_008{9, 8, DPTFamily::FLOAT16, 16, 1, 1, 0.0f, 670760.96f, "ppm"};
+// 9.010 - Time
+inline constexpr DPTDescriptor DPT_9_010{9, 10, DPTFamily::FLOAT16, 16, 1, 1, -671088.64f, 670760.96f, "s"};
+// 9.011 - Time (ms)
+inline constexpr DPTDescriptor DPT_9_011{9, 11, DPTFamily::FLOAT16, 16, 1, 1, -671088.64f, 670760.96f, "ms"};
+// 9.020 - Voltage
+inline constexpr DPTDescriptor DPT_9_020{9, 20, DPTFamily::FLOAT16, 16, 1, 1, -671088.64f, 670760.96f, "mV"};
+// 9.021 - Current
+inline constexpr DPTDescriptor DPT_9_021{9, 21, DPTFamily::FLOAT16, 16, 1, 1, -671088.64f, 670760.96f, "mA"};
+// 9.024 - Power
+inline constexpr DPTDescriptor DPT_9_024{9, 24, DPTFamily::FLOAT16, 16, 1, 1, -671088.64f, 670760.96f, "kW"};
+// 9.025 - Volume flow
+inline constexpr DPTDescriptor DPT_9_025{9, 25, DPTFamily::FLOAT16, 16, 1, 1, -671088.64f, 670760.96f, "l/h"};
+// 9.026 - Rain amount
+inline constexpr DPTDescriptor DPT_9_026{9, 26, DPTFamily::FLOAT16, 16, 1, 1, -671088.64f, 670760.96f, "l/m²"};
+// 9.027 - Temperature (°F)
+inline constexpr DPTDescriptor DPT_9_027{9, 27, DPTFamily::FLOAT16, 16, 1, 1, -459.6f, 670760.96f, "°F"};
+// 9.028 - Wind speed (km/h)
+inline constexpr DPTDescriptor DPT_9_028{9, 28, DPTFamily::FLOAT16, 16, 1, 1, 0.0f, 670760.96f, "km/h"};
+// 9.029 - Absolute humidity
+inline constexpr DPTDescriptor DPT_9_029{9, 29, DPTFamily::FLOAT16, 16, 1, 1, 0.0f, 670760.96f, "g/m³"};
+// 9.030 - Concentration
+inline constexpr DPTDescriptor DPT_9_030{9, 30, DPTFamily::FLOAT16, 16, 1, 1, 0.0f, 670760.96f, "µg/m³"};
+
+// 12.xxx - 4-byte unsigned
+inline constexpr DPTDescriptor DPT_12{12, 0, DPTFamily::UNSIGNED, 32, 1, 1, 0.0f, 4294967295.0f, ""};
+// 12.001 - Counter
+inline constexpr DPTDescriptor DPT_12_001{12, 1, DPTFamily::UNSIGNED, 32, 1, 1, 0.0f, 4294967295.0f, "pulses"};
+// 12.100 - Long time period (s)
+inline constexpr DPTDescriptor DPT_12_100{12, 100, DPTFamily::UNSIGNED, 32, 1, 1, 0.0f, 4294967295.0f, "s"};
+// 12.101 - Long time period (min)
+inline constexpr DPTDescriptor DPT_12_101{12, 101, DPTFamily::UNSIGNED, 32, 1, 1, 0.0f, 4294967295.0f, "min"};
+// 12.102 - Long time period (h)
+inline constexpr DPTDescriptor DPT_12_102{12, 102, DPTFamily::UNSIGNED, 32, 1, 1, 0.0f, 4294967295.0f, "h"};
+// 12.1200 - Volume (liquid)
+inline constexpr DPTDescriptor DPT_12_1200{12, 1200, DPTFamily::UNSIGNED, 32, 1, 1, 0.0f, 4294967295.0f, "l"};
+// 12.1201 - Volume
+inline constexpr DPTDescriptor DPT_12_1201{12, 1201, DPTFamily::UNSIGNED, 32, 1, 1, 0.0f, 4294967295.0f, "m³"};
+
+// 13.xxx - 4-byte signed
+inline constexpr DPTDescriptor DPT_13{13, 0, DPTFamily::SIGNED, 32, 1, 1, -2147483648.0f, 2147483647.0f, ""};
+// 13.001 - Counter
+inline constexpr DPTDescriptor DPT_13_001{13, 1, DPTFamily::SIGNED, 32, 1, 1, -2147483648.0f, 2147483647.0f, "pulses"};
+// 13.002 - Flow rate
+inline constexpr DPTDescriptor DPT_13_002{13, 2, DPTFamily::SIGNED, 32, 1, 10000, -214748.3648f, 214748.3647f, "m³/h"};
+// 13.010 - Active energy
+inline constexpr DPTDescriptor DPT_13_010{13, 10, DPTFamily::SIGNED, 32, 1, 1, -2147483648.0f, 2147483647.0f, "Wh"};
+// 13.011 - Apparent energy
+inline constexpr DPTDescriptor DPT_13_011{13, 11, DPTFamily::SIGNED, 32, 1, 1, -2147483648.0f, 2147483647.0f, "VAh"};
+// 13.012 - Reactive energy
+inline constexpr DPTDescriptor DPT_13_012{13, 12, DPTFamily::SIGNED, 32, 1, 1, -2147483648.0f, 2147483647.0f, "VARh"};
+// 13.013 - Active energy (kWh)
+inline constexpr DPTDescriptor DPT_13_013{13, 13, DPTFamily::SIGNED, 32, 1, 1, -2147483648.0f, 2147483647.0f, "kWh"};
+// 13.014 - Apparent energy (kVAh)
+inline constexpr DPTDescriptor DPT_13_014{13, 14, DPTFamily::SIGNED, 32, 1, 1, -2147483648.0f, 2147483647.0f, "kVAh"};
+// 13.015 - Reactive energy (kVARh)
+inline constexpr DPTDescriptor DPT_13_015{13, 15, DPTFamily::SIGNED, 32, 1, 1, -2147483648.0f, 2147483647.0f, "kVARh"};
+// 13.100 - Long delta time
+inline constexpr DPTDescriptor DPT_13_100{13, 100, DPTFamily::SIGNED, 32, 1, 1, -2147483648.0f, 2147483647.0f, "s"};
+
+// 14.xxx - 4-byte float
+inline constexpr DPTDescriptor DPT_14{14, 0, DPTFamily::FLOAT32, 32, 1, 1, -3.40282347e+38f, 3.40282347e+38f, ""};
+// 14.007 - Angle
+inline constexpr DPTDescriptor DPT_14_007{14, 7, DPTFamily::FLOAT32, 32, 1, 1, -3.40282347e+38f, 3.40282347e+38f, "°"};
+// 14.017 - Density
+inline constexpr DPTDescriptor DPT_14_017{14, 17, DPTFamily::FLOAT32, 32, 1, 1, -3.40282347e+38f, 3.40282347e+38f, "kg/m³"};
+// 14.019 - Electric current
+inline constexpr DPTDescriptor DPT_14_019{14, 19, DPTFamily::FLOAT32, 32, 1, 1, -3.40282347e+38f, 3.40282347e+38f, "A"};
+// 14.027 - Electric potential
+inline constexpr DPTDescriptor DPT_14_027{14, 27, DPTFamily::FLOAT32, 32, 1, 1, -3.40282347e+38f, 3.40282347e+38f, "V"};
+// 14.031 - Energy
+inline constexpr DPTDescriptor DPT_14_031{14, 31, DPTFamily::FLOAT32, 32, 1, 1, -3.40282347e+38f, 3.40282347e+38f, "J"};
+// 14.033 - Frequency
+inline constexpr DPTDescriptor DPT_14_033{14, 33, DPTFamily::FLOAT32, 32, 1, 1, -3.40282347e+38f, 3.40282347e+38f, "Hz"};
+// 14.039 - Length
+inline constexpr DPTDescriptor DPT_14_039{14, 39, DPTFamily::FLOAT32, 32, 1, 1, -3.40282347e+38f, 3.40282347e+38f, "m"};
+// 14.051 - Mass
+inline constexpr DPTDescriptor DPT_14_051{14, 51, DPTFamily::FLOAT32, 32, 1, 1, -3.40282347e+38f, 3.40282347e+38f, "kg"};
+// 14.056 - Power
+inline constexpr DPTDescriptor DPT_14_056{14, 56, DPTFamily::FLOAT32, 32, 1, 1, -3.40282347e+38f, 3.40282347e+38f, "W"};
+// 14.057 - Power factor
+inline constexpr DPTDescriptor DPT_14_057{14, 57, DPTFamily::FLOAT32, 32, 1, 1, -3.40282347e+38f, 3.40282347e+38f, ""};
+// 14.065 - Speed
+inline constexpr DPTDescriptor DPT_14_065{14, 65, DPTFamily::FLOAT32, 32, 1, 1, -3.40282347e+38f, 3.40282347e+38f, "m/s"};
+// 14.068 - Temperature
+inline constexpr DPTDescriptor DPT_14_068{14, 68, DPTFamily::FLOAT32, 32, 1, 1, -3.40282347e+38f, 3.40282347e+38f, "°C"};
+// 14.076 - Volume
+inline constexpr DPTDescriptor DPT_14_076{14, 76, DPTFamily::FLOAT32, 32, 1, 1, -3.40282347e+38f, 3.40282347e+38f, "m³"};
+
+// 17.001 - Scene number
+inline constexpr DPTDescriptor DPT_17_001{17, 1, DPTFamily::SCENE_NUMBER, 8, 1, 1, 0.0f, 63.0f, ""};
+
+// 18.001 - Scene control
+inline constexpr DPTDescriptor DPT_18_001{18, 1, DPTFamily::SCENE_CONTROL, 8, 1, 1, 0.0f, 191.0f, ""};
+
+// 20.102 - HVAC mode
+inline constexpr DPTDescriptor DPT_20_102{20, 102, DPTFamily::UNSIGNED, 8, 1, 1, 0.0f, 4.0f, ""};
+
+// 232.600 - RGB colour
+inline constexpr DPTDescriptor DPT_232_600{232, 600, DPTFamily::RGB, 24, 1, 1, 0.0f, 0.0f, ""};
+
+// 251.600 - RGBW colour
+inline constexpr DPTDescriptor DPT_251_600{251, 600, DPTFamily::RGBW, 48, 1, 1, 0.0f, 0.0f, ""};
+
+// All of the above, for compile-time lookups
+inline constexpr const DPTDescriptor *DPT_REGISTRY[] = {
+    &DPT_1,
+    &DPT_1_001,
+    &DPT_1_002,
+    &DPT_1_003,
+    &DPT_1_005,
+    &DPT_1_007,
+    &DPT_1_008,
+    &DPT_1_009,
+    &DPT_1_010,
+    &DPT_5,
+    &DPT_5_001,
+    &DPT_5_003,
+    &DPT_5_004,
+    &DPT_5_010,
+    &DPT_6,
+    &DPT_6_001,
+    &DPT_6_010,
+    &DPT_7,
+    &DPT_7_001,
+    &DPT_7_002,
+    &DPT_7_003,
+    &DPT_7_004,
+    &DPT_7_005,
+    &DPT_7_006,
+    &DPT_7_007,
+    &DPT_7_011,
+    &DPT_7_012,
+    &DPT_7_013,
+    &DPT_7_600,
+    &DPT_8,
+    &DPT_8_001,
+    &DPT_8_002,
+    &DPT_8_003,
+    &DPT_8_004,
+    &DPT_8_005,
+    &DPT_8_006,
+    &DPT_8_007,
+    &DPT_8_010,
+    &DPT_8_011,
+    &DPT_9,
+    &DPT_9_001,
+    &DPT_9_002,
+    &DPT_9_003,
+    &DPT_9_004,
+    &DPT_9_005,
+    &DPT_9_006,
+    &DPT_9_007,
+    &DPT_9_008,
+    &DPT_9_010,
+    &DPT_9_011,
+    &DPT_9_020,
+    &DPT_9_021,
+    &DPT_9_024,
+    &DPT_9_025,
+    &DPT_9_026,
+    &DPT_9_027,
+    &DPT_9_028,
+    &DPT_9_029,
+    &DPT_9_030,
+    &DPT_12,
+    &DPT_12_001,
+    &DPT_12_100,
+    &DPT_12_101,
+    &DPT_12_102,
+    &DPT_12_1200,
+    &DPT_12_1201,
+    &DPT_13,
+    &DPT_13_001,
+    &DPT_13_002,
+    &DPT_13_010,
+    &DPT_13_011,
+    &DPT_13_012,
+    &DPT_13_013,
+    &DPT_13_014,
+    &DPT_13_015,
+    &DPT_13_100,
+    &DPT_14,
+    &DPT_14_007,
+    &DPT_14_017,
+    &DPT_14_019,
+    &DPT_14_027,
+    &DPT_14_031,
+    &DPT_14_033,
+    &DPT_14_039,
+    &DPT_14_051,
+    &DPT_14_056,
+    &DPT_14_057,
+    &DPT_14_065,
+    &DPT_14_068,
+    &DPT_14_076,
+    &DPT_17_001,
+    &DPT_18_001,
+    &DPT_20_102,
+    &DPT_232_600,
+    &DPT_251_600,
+};
+
+/**
+ * Find a descriptor by main/sub number (sub 0 = main type alone)
+ * Meant for constant expressions, e.g. static_assert(find_dpt(9, 1) == &DPT_9_001);
+ * used at runtime it pulls the whole registry into flash
+ */
+constexpr const DPTDescriptor *find_dpt(uint16_t main, uint16_t sub) {
+  for (const DPTDescriptor *dpt : DPT_REGISTRY) {
+    if (dpt->main == main && dpt->sub == sub) {
+      return dpt;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace knx_ip
+}  // namespace esphome
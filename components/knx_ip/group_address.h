@@ -1,10 +1,42 @@
 #pragma once
 
 #include <string>
+#include <cstdint>
+
+// Runtime parsing of "main/middle/sub" address strings. Codegen emits every
+// group and physical address as a uint16_t constant, so this is only needed by
+// lambdas that address the bus with strings (debug builds):
+// -DUSE_KNX_ADDRESS_PARSER=1
+#ifndef USE_KNX_ADDRESS_PARSER
+#define USE_KNX_ADDRESS_PARSER 0
+#endif
 
 namespace esphome {
 namespace knx_ip {
 
+/**
+ * Group object flags, as shown by ETS for a communication object
+ */
+enum GroupObjectFlag : uint8_t {
+  GO_FLAG_COMMUNICATION = 1 << 0,  // C: object is linked to the bus
+  GO_FLAG_READ = 1 << 1,           // R: answers GroupValue_Read with its value
+  GO_FLAG_WRITE = 1 << 2,          // W: accepts GroupValue_Write from the bus
+  GO_FLAG_TRANSMIT = 1 << 3,       // T: sends a telegram when written locally
+  GO_FLAG_UPDATE = 1 << 4,         // U: accepts GroupValue_Response as an update
+  GO_FLAG_READ_ON_INIT = 1 << 5,   // I: reads its value from the bus at startup
+};
+
+/**
+ * Group object of the device, as generated by codegen: one per group address
+ * in use, sorted by address, in a constexpr table that stays in flash.
+ * Its position in the table is the group object number - 1
+ */
+struct GroupObjectEntry {
+  uint16_t ga;         // Raw group address
+  uint8_t flags;       // GroupObjectFlag bits, from every entity using the address
+  uint8_t value_bits;  // Value size in bits, from the entities' DPT or the "dpt" option
+};
+
 /**
  * Represents a KNX Group Address
  * Group addresses are used for multicast communication in KNX
@@ -13,14 +45,22 @@ class GroupAddress {
  public:
   GroupAddress() = default;
   
-  void set_id(const std::string &id) { id_ = id; }
-  std::string get_id() const { return id_; }
+  // The id is a string literal emitted by codegen (stays in flash)
+  void set_id(const char *id) { id_ = id; }
+  const char *get_id() const { return id_; }
 
+#if USE_KNX_ADDRESS_PARSER
   void set_address(const std::string &address);
+#endif
   void set_address(uint16_t address) { address_ = address; }
-  std::string get_address() const;
+  std::string get_address() const { return to_string(address_); }
   uint16_t get_address_int() const { return address_; }
 
+  /**
+   * Format a raw group address as "main/middle/sub"
+   */
+  static std::string to_string(uint16_t address);
+
   /**
    * Get address components
    */
@@ -29,7 +69,7 @@ class GroupAddress {
   uint8_t get_sub_group() const { return address_ & 0xFF; }
 
  protected:
-  std::string id_;          // Manteniamo solo l'ID come stringa (necessario per lookup)
+  const char *id_{""};      // ID per il lookup dalle lambda (letterale in flash)
   uint16_t address_{0};     // Indirizzo in formato intero (risparmio ~29 bytes)
 };
 
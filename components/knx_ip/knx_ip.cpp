@@ -1,14 +1,25 @@
 #include "knx_ip.h"
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
+#include <algorithm>
+#include <cstring>
 
 #ifdef USE_TIME
 #include "esphome/components/time/real_time_clock.h"
 #endif
 
 // Include Thelsing KNX stack for IP
+#ifdef USE_HOST
+#include <linux_platform.h>
+#else
 #include <esp32_idf_platform.h>
+#endif
 #include <knx/bau57B0.h>
+#include <knx/group_object_table_object.h>
+#include <knx/group_object.h>
+#include <knx/table_object.h>
+#include <knx/property.h>
+#include <knx/memory.h>
 
 namespace esphome {
 namespace knx_ip {
@@ -18,11 +29,13 @@ static constexpr const char* TAG = "knx_ip";
 void KNXIPComponent::setup() {
   ESP_LOGCONFIG(TAG, "Setting up KNX IP...");
 
-  // Parse physical address
-  this->physical_address_int_ = this->parse_physical_address_(this->physical_address_);
-
+#ifdef USE_HOST
+  // Host build: Linux sockets (multicast on loopback works for local testing)
+  this->platform_ = new LinuxPlatform();
+#else
   // Initialize Thelsing KNX platform for ESP-IDF
   this->platform_ = new Esp32IdfPlatform();
+#endif
 
   // Initialize IP BAU (Bau57B0 for IP vs Bau07B0 for TP)
   this->bau_ = new Bau57B0(*this->platform_);
@@ -50,15 +63,11 @@ void KNXIPComponent::setup() {
     #endif
   }
 
-  // Configure group objects for each registered group address
-  auto& groupObjectTable = this->bau_->groupObjectTable();
-  uint16_t go_index = 1;  // Group object indices start at 1
-
-  for (auto *ga : this->group_addresses_) {
-    uint16_t ga_int = ga->get_address_int();
-    ESP_LOGD(TAG, "Configuring group object %u for GA %s (%u)",
-             go_index, ga->get_address().c_str(), ga_int);
-    go_index++;
+  // Bind a group object to every GA in use, so the stack drops all other traffic
+  if (!this->configure_group_objects_()) {
+    ESP_LOGE(TAG, "Failed to load group object tables");
+    this->mark_failed();
+    return;
   }
 
   // Enable the KNX device
@@ -77,9 +86,12 @@ void KNXIPComponent::loop() {
   // This processes incoming/outgoing KNX/IP frames
   this->bau_->loop();
 
+  // Publish coalescing: one delivery per listener for everything received this loop
+  this->flush_pending_values_();
+
   // Handle time broadcast if configured
   #ifdef USE_TIME
-  if (this->time_source_ != nullptr && !this->time_broadcast_ga_id_.empty()) {
+  if (this->time_source_ != nullptr && this->time_broadcast_ga_ != nullptr) {
     uint32_t now = millis();
     if (now - this->last_time_broadcast_ >= this->time_broadcast_interval_) {
       this->broadcast_time_();
@@ -91,7 +103,8 @@ void KNXIPComponent::loop() {
 
 void KNXIPComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "KNX IP:");
-  ESP_LOGCONFIG(TAG, "  Physical Address: %s", this->physical_address_.c_str());
+  ESP_LOGCONFIG(TAG, "  Physical Address: %s (0x%04X)", this->get_physical_address().c_str(),
+                this->physical_address_int_);
   ESP_LOGCONFIG(TAG, "  Mode: %s", this->routing_mode_ ? "Routing" : "Tunneling");
 
   if (this->routing_mode_) {
@@ -100,72 +113,275 @@ void KNXIPComponent::dump_config() {
     ESP_LOGCONFIG(TAG, "  Gateway: %s:%d", this->gateway_ip_.c_str(), this->gateway_port_);
   }
 
-  ESP_LOGCONFIG(TAG, "  Group Addresses: %d", this->group_addresses_.size());
+  ESP_LOGCONFIG(TAG, "  Group Addresses: %u", static_cast<unsigned>(this->group_addresses_.size()));
   for (auto *ga : this->group_addresses_) {
-    ESP_LOGCONFIG(TAG, "    - %s: %s", ga->get_id().c_str(), ga->get_address().c_str());
+    // Group object flags in ETS order, '-' when unset
+    const GroupObjectEntry *object = this->find_group_object_(ga->get_address_int());
+    uint8_t flags = object != nullptr ? object->flags : 0;
+    char flag_str[7] = {
+        (flags & GO_FLAG_COMMUNICATION) ? 'C' : '-', (flags & GO_FLAG_READ) ? 'R' : '-',
+        (flags & GO_FLAG_WRITE) ? 'W' : '-',         (flags & GO_FLAG_TRANSMIT) ? 'T' : '-',
+        (flags & GO_FLAG_UPDATE) ? 'U' : '-',        (flags & GO_FLAG_READ_ON_INIT) ? 'I' : '-', '\0'};
+    ESP_LOGCONFIG(TAG, "    - %s: %s %s, %u bits", ga->get_id(), ga->get_address().c_str(), flag_str,
+                  object != nullptr ? object->value_bits : 0);
+  }
+  ESP_LOGCONFIG(TAG, "  Group Objects: %u", static_cast<unsigned>(this->group_object_count_));
+  ESP_LOGCONFIG(TAG, "  RX Filter: %u bytes%s", static_cast<unsigned>(GAFilter::size_bytes()),
+                GAFilter::BITS == 65536 ? "" : " (compact)");
+  if (this->coalesce_publish_) {
+    ESP_LOGCONFIG(TAG, "  Publish Coalescing: enabled");
   }
 
-  ESP_LOGCONFIG(TAG, "  Entities: %d", this->entities_.size());
+  ESP_LOGCONFIG(TAG, "  Entities: %u", static_cast<unsigned>(this->entities_.size()));
+  if (!this->telegram_entities_.empty()) {
+    // They need every telegram, so the RX filter lets everything through
+    ESP_LOGCONFIG(TAG, "    Legacy (on_knx_telegram): %u", static_cast<unsigned>(this->telegram_entities_.size()));
+  }
+  if (this->listener_table_stale_) {
+    this->build_listener_table_();
+  }
+  size_t listened = 0;
+  for (size_t i = 0; i < this->group_object_count_; i++) {
+    listened += this->go_listener_start_[i] != this->go_listener_start_[i + 1];
+  }
+  ESP_LOGCONFIG(TAG, "  Listened Group Addresses: %u", static_cast<unsigned>(listened));
 
   if (this->time_source_ != nullptr) {
-    ESP_LOGCONFIG(TAG, "  Time Broadcast: enabled (interval: %dms)", this->time_broadcast_interval_);
+    ESP_LOGCONFIG(TAG, "  Time Broadcast: enabled (interval: %ums)",
+                  static_cast<unsigned>(this->time_broadcast_interval_));
   }
 }
 
+#if USE_KNX_ADDRESS_PARSER
 void KNXIPComponent::set_physical_address(const std::string &address) {
-  this->physical_address_ = address;
+  this->physical_address_int_ = this->parse_physical_address_(address);
 }
+#endif
+
+std::string KNXIPComponent::get_physical_address() const {
+  // Individual address: AAAA.LLLL.DDDDDDDD (area 4 bits, line 4 bits, device 8 bits)
+  char addr[16];
+  snprintf(addr, sizeof(addr), "%u.%u.%u", (this->physical_address_int_ >> 12) & 0x0F,
+           (this->physical_address_int_ >> 8) & 0x0F, this->physical_address_int_ & 0xFF);
+  return std::string(addr);
+}
+
+static bool ga_id_less(const GroupAddress *a, const GroupAddress *b) { return strcmp(a->get_id(), b->get_id()) < 0; }
 
 void KNXIPComponent::register_group_address(GroupAddress *ga) {
-  this->group_addresses_.push_back(ga);
+  // Codegen registers in id order, so this appends; keep the vector sorted for
+  // get_group_address() either way
+  auto pos = this->group_addresses_.end();
+  if (!this->group_addresses_.empty() && ga_id_less(ga, this->group_addresses_.back())) {
+    pos = std::upper_bound(this->group_addresses_.begin(), this->group_addresses_.end(), ga, ga_id_less);
+  }
+  this->group_addresses_.insert(pos, ga);
 }
 
 void KNXIPComponent::register_entity(KNXEntity *entity) {
   this->entities_.push_back(entity);
   entity->set_knx_component(this);
-  ESP_LOGD(TAG, "Registered entity (total: %d)", this->entities_.size());
+  if (!entity->uses_listeners()) {
+    // Written against on_knx_telegram(): it expects every telegram
+    this->telegram_entities_.push_back(entity);
+    this->rx_filter_.add_all();
+  }
+  ESP_LOGD(TAG, "Registered entity (total: %u)", static_cast<unsigned>(this->entities_.size()));
+}
+
+void KNXIPComponent::register_listener(GroupAddress *ga, KNXEntity *entity, uint8_t role) {
+  if (ga == nullptr) {
+    ESP_LOGW(TAG, "Cannot register listener: no group address");
+    return;
+  }
+  // Growing listeners_ moves the entries dirty_listeners_ points to
+  this->flush_pending_values_();
+  this->listeners_.push_back({entity, ga->get_address_int(), role, false, 0, {}});
+  this->listener_table_stale_ = true;
+  this->rx_filter_.add(ga->get_address_int());
+  ESP_LOGD(TAG, "Registered listener on %s (%s), role %u", ga->get_id(), ga->get_address().c_str(), role);
+}
+
+void KNXIPComponent::register_listener(const std::string &ga_id, KNXEntity *entity, uint8_t role) {
+  auto *ga = this->get_group_address(ga_id);
+  if (ga == nullptr) {
+    ESP_LOGW(TAG, "Cannot register listener: Group address %s not found", ga_id.c_str());
+    return;
+  }
+  this->register_listener(ga, entity, role);
+}
+
+// KNX group object value type code for a value size in bits (descriptor bits 0-5)
+static uint8_t go_type_code(uint8_t bits) {
+  if (bits < 8) {
+    return bits - 1;  // 1..7 bit values: codes 0..6
+  }
+  switch (bits / 8) {
+    case 1: return 7;
+    case 2: return 8;
+    case 3: return 9;
+    case 4: return 10;
+    case 6: return 11;
+    case 8: return 12;
+    case 10: return 13;
+    default: return 14;  // 14 bytes (DPT 16)
+  }
+}
+
+// Load a table object the way ETS does: start loading, allocate the table's
+// data segment, write the image into it, then mark it loaded
+static bool load_table_object(Bau57B0 *bau, ObjectType type, std::vector<uint8_t> &image) {
+  auto *table = static_cast<TableObject *>(bau->getInterfaceObject(type, 0));
+  if (table == nullptr) {
+    return false;
+  }
+
+  uint8_t count = 1;
+  uint8_t start[10] = {LE_START_LOADING};
+  table->writeProperty(PID_LOAD_STATE_CONTROL, 1, start, count);
+
+  // Additional load control 0x0B: allocate a zero-filled segment of image.size() bytes
+  uint32_t size = image.size();
+  uint8_t alloc[10] = {LE_ADDITIONAL_LOAD_CONTROLS, 0x0B,
+                       static_cast<uint8_t>(size >> 24), static_cast<uint8_t>(size >> 16),
+                       static_cast<uint8_t>(size >> 8), static_cast<uint8_t>(size),
+                       0x01, 0x00};
+  count = 1;
+  table->writeProperty(PID_LOAD_STATE_CONTROL, 1, alloc, count);
+
+  // Copy the image to where the table now lives
+  uint8_t ref[4] = {0};
+  count = 1;
+  table->readProperty(PID_TABLE_REFERENCE, 1, count, ref);
+  if (count == 0) {
+    return false;
+  }
+  uint32_t rel_addr = (ref[0] << 24) | (ref[1] << 16) | (ref[2] << 8) | ref[3];
+  bau->memory().writeMemory(rel_addr, image.size(), image.data());
+
+  count = 1;
+  uint8_t completed[10] = {LE_LOAD_COMPLETED};
+  table->writeProperty(PID_LOAD_STATE_CONTROL, 1, completed, count);
+
+  return table->loadState() == LS_LOADED;
+}
+
+bool KNXIPComponent::configure_group_objects_() {
+  // One group object per GA, straight from the codegen table: already sorted
+  // by address (as ETS sorts the address table), merged, flagged and sized
+  const GroupObjectEntry *objects = this->group_objects_;
+
+  // Table images: address table = count + GAs (tsap 1..N), association table =
+  // count + (tsap, asap) pairs, group object table = count + descriptors
+  size_t n = this->group_object_count_;
+  std::vector<uint8_t> addr_table, assoc_table, go_table;
+  addr_table.reserve(2 + 2 * n);
+  assoc_table.reserve(2 + 4 * n);
+  go_table.reserve(2 + 2 * n);
+  auto put16 = [](std::vector<uint8_t> &image, uint16_t value) {
+    image.push_back(value >> 8);
+    image.push_back(value & 0xFF);
+  };
+  put16(addr_table, n);
+  put16(assoc_table, n);
+  put16(go_table, n);
+
+  for (size_t i = 0; i < n; i++) {
+    const auto &object = objects[i];
+    uint16_t index = i + 1;  // tsap == asap
+    put16(addr_table, object.ga);
+    put16(assoc_table, index);
+    put16(assoc_table, index);
+
+    // Descriptor: U T I W R C flags (bits 15-10), priority low (bits 7-6), value type (bits 5-0)
+    uint16_t descriptor = go_type_code(object.value_bits) | (LowPriority << 6);
+    if (object.flags & GO_FLAG_COMMUNICATION) descriptor |= 1 << 10;
+    if (object.flags & GO_FLAG_READ) descriptor |= 1 << 11;
+    if (object.flags & GO_FLAG_WRITE) descriptor |= 1 << 12;
+    if (object.flags & GO_FLAG_READ_ON_INIT) descriptor |= 1 << 13;
+    if (object.flags & GO_FLAG_TRANSMIT) descriptor |= 1 << 14;
+    if (object.flags & GO_FLAG_UPDATE) descriptor |= 1 << 15;
+    put16(go_table, descriptor);
+  }
+
+  // No application program parameters, but the stack only runs once it is loaded
+  std::vector<uint8_t> app_program = {0};
+  if (!load_table_object(this->bau_, OT_ADDR_TABLE, addr_table) ||
+      !load_table_object(this->bau_, OT_ASSOC_TABLE, assoc_table) ||
+      !load_table_object(this->bau_, OT_GRP_OBJ_TABLE, go_table) ||
+      !load_table_object(this->bau_, OT_APPLICATION_PROG, app_program)) {
+    return false;
+  }
+
+  // Route group object updates to the dispatch index
+  auto &table = this->bau_->groupObjectTable();
+  for (size_t i = 0; i < n; i++) {
+    uint16_t ga = objects[i].ga;
+    table.get(i + 1).callback([this, i](GroupObject &go) {
+      this->group_object_callback_(i, go.valueRef(), go.valueSize());
+    });
+    ESP_LOGD(TAG, "Group object %u -> GA %s (%u bits, flags 0x%02X)", static_cast<unsigned>(i + 1),
+             GroupAddress::to_string(ga).c_str(), objects[i].value_bits, objects[i].flags);
+  }
+
+  ESP_LOGCONFIG(TAG, "Configured %u group objects", static_cast<unsigned>(n));
+  return true;
 }
 
 GroupAddress *KNXIPComponent::get_group_address(const std::string &id) {
-  for (auto *ga : this->group_addresses_) {
-    if (ga->get_id() == id) {
-      return ga;
-    }
+  // group_addresses_ is sorted by id: binary search
+  auto it = std::lower_bound(this->group_addresses_.begin(), this->group_addresses_.end(), id,
+                             [](const GroupAddress *ga, const std::string &key) { return key.compare(ga->get_id()) > 0; });
+  if (it != this->group_addresses_.end() && id.compare((*it)->get_id()) == 0) {
+    return *it;
   }
   return nullptr;
 }
 
-void KNXIPComponent::send_telegram(const std::string &dest_addr, const std::vector<uint8_t> &data) {
+const GroupObjectEntry *KNXIPComponent::find_group_object_(uint16_t ga) const {
+  // The group object table is sorted by address: binary search
+  const GroupObjectEntry *end = this->group_objects_ + this->group_object_count_;
+  const GroupObjectEntry *it = std::lower_bound(
+      this->group_objects_, end, ga, [](const GroupObjectEntry &object, uint16_t key) { return object.ga < key; });
+  return it != end && it->ga == ga ? it : nullptr;
+}
+
+#if USE_KNX_ADDRESS_PARSER
+void KNXIPComponent::send_telegram(const std::string &dest_addr, const uint8_t *data, size_t len) {
+  GroupAddress dest;
+  dest.set_address(dest_addr);
+  this->send_telegram(dest.get_address_int(), data, len);
+}
+#endif
+
+void KNXIPComponent::send_telegram(uint16_t dest, const uint8_t *data, size_t len) {
   if (!this->bau_) {
     ESP_LOGW(TAG, "BAU not initialized, cannot send telegram");
     return;
   }
 
-  ESP_LOGD(TAG, "Sending telegram to %s with %d bytes", dest_addr.c_str(), data.size());
-
-  // Find the group object for this address
-  auto& groupObjectTable = this->bau_->groupObjectTable();
+  ESP_LOGD(TAG, "Sending telegram to %u/%u/%u with %u bytes", (dest >> 11) & 0x1F, (dest >> 8) & 0x07,
+           dest & 0xFF, static_cast<unsigned>(len));
 
-  // For simplicity, we'll use the lower-level telegram interface
-  // In a full implementation, you'd map to specific group objects
+  // Not yet handed to the stack: the telegram is only logged
 
-  if (data.size() > 0) {
+  if (len > 0) {
     // Usa buffer statico invece di std::string per evitare allocazioni
     // Max 32 bytes di dati = 96 caratteri (3 per byte) + null terminator
     char data_hex[97];
     size_t offset = 0;
-    for (size_t i = 0; i < data.size() && i < 32; i++) {
+    for (size_t i = 0; i < len && offset + 3 < sizeof(data_hex); i++) {
       offset += snprintf(data_hex + offset, sizeof(data_hex) - offset, "%02X ", data[i]);
     }
     ESP_LOGV(TAG, "  Data: %s", data_hex);
   }
 }
 
-void KNXIPComponent::send_group_write(const std::string &ga_id, const std::vector<uint8_t> &data) {
+void KNXIPComponent::send_group_write(const std::string &ga_id, const uint8_t *data, size_t len) {
   auto ga = this->get_group_address(ga_id);
   if (ga != nullptr) {
     ESP_LOGD(TAG, "Group write to %s (%s)", ga_id.c_str(), ga->get_address().c_str());
-    this->send_telegram(ga->get_address(), data);
+    this->send_group_write(ga->get_address_int(), data, len);
   } else {
     ESP_LOGW(TAG, "Cannot send group write: Group address %s not found", ga_id.c_str());
   }
@@ -175,18 +391,17 @@ void KNXIPComponent::send_group_read(const std::string &ga_id) {
   auto ga = this->get_group_address(ga_id);
   if (ga != nullptr) {
     ESP_LOGD(TAG, "Group read request to %s (%s)", ga_id.c_str(), ga->get_address().c_str());
-    std::vector<uint8_t> empty_data;
-    this->send_telegram(ga->get_address(), empty_data);
+    this->send_group_read(ga->get_address_int());
   } else {
     ESP_LOGW(TAG, "Cannot send group read: Group address %s not found", ga_id.c_str());
   }
 }
 
-void KNXIPComponent::send_group_response(const std::string &ga_id, const std::vector<uint8_t> &data) {
+void KNXIPComponent::send_group_response(const std::string &ga_id, const uint8_t *data, size_t len) {
   auto ga = this->get_group_address(ga_id);
   if (ga != nullptr) {
     ESP_LOGD(TAG, "Group response to %s (%s)", ga_id.c_str(), ga->get_address().c_str());
-    this->send_telegram(ga->get_address(), data);
+    this->send_group_response(ga->get_address_int(), data, len);
   } else {
     ESP_LOGW(TAG, "Cannot send group response: Group address %s not found", ga_id.c_str());
   }
@@ -194,7 +409,7 @@ void KNXIPComponent::send_group_response(const std::string &ga_id, const std::ve
 
 void KNXIPComponent::broadcast_time_() {
   #ifdef USE_TIME
-  if (this->time_source_ == nullptr || this->time_broadcast_ga_id_.empty()) {
+  if (this->time_source_ == nullptr || this->time_broadcast_ga_ == nullptr) {
     return;
   }
 
@@ -222,20 +437,113 @@ void KNXIPComponent::broadcast_time_() {
   dt.no_time = false;
   dt.summer_time = false;  // Could check DST if needed
 
-  std::vector<uint8_t> data = DPT::encode_dpt19(dt);
-  this->send_group_write(this->time_broadcast_ga_id_, data);
+  auto data = DPT::encode_dpt19_fixed(dt);
+  this->send_group_write(this->time_broadcast_ga_->get_address_int(), data);
 
   ESP_LOGD(TAG, "Broadcast time: %04d-%02d-%02d %02d:%02d:%02d",
            dt.year, dt.month, dt.day, dt.hour, dt.minute, dt.second);
   #endif
 }
 
-void KNXIPComponent::notify_entities_(const std::string &ga, const std::vector<uint8_t> &data) {
-  for (auto *entity : this->entities_) {
-    entity->on_knx_telegram(ga, data);
+void KNXIPComponent::notify_entities_(size_t object, uint16_t ga, const uint8_t *data, uint8_t len) {
+  // Legacy entities get everything, with the string/vector arguments they expect
+  if (!this->telegram_entities_.empty()) {
+    std::string ga_str = GroupAddress::to_string(ga);
+    std::vector<uint8_t> payload(data, data + len);
+    for (auto *entity : this->telegram_entities_) {
+      entity->on_knx_telegram(ga_str, payload);
+    }
+  }
+
+  // Notify only the entities listening on this group object: one indexed slice of the flat table
+  if (this->listener_table_stale_) {
+    this->build_listener_table_();
+  }
+  uint16_t first_listener = this->go_listener_start_[object];
+  uint16_t last_listener = this->go_listener_start_[object + 1];
+  for (uint16_t k = first_listener; k < last_listener; k++) {
+    KNXListener &listener = this->listeners_[this->go_listeners_[k]];
+    if (this->coalesce_publish_ && len <= KNX_COALESCE_MAX_PAYLOAD) {
+      // Park the value: the entity publishes once, at the end of loop(), with the latest one
+      if (!listener.dirty) {
+        listener.dirty = true;
+        this->dirty_listeners_.emplace_back(ga, &listener);
+      }
+      memcpy(listener.pending, data, len);
+      listener.pending_len = len;
+      continue;
+    }
+    // Delivered now: a value parked earlier this loop is older, drop it
+    listener.dirty = false;
+    listener.entity->on_knx_group_value(listener.role, ga, data, len);
   }
 }
 
+void KNXIPComponent::build_listener_table_() {
+  // Bucket the listeners by group object once (the stack delivers no other GA):
+  // group object i gets a contiguous slice of listener indices, in registration order
+  size_t n = this->group_object_count_;
+  this->go_listener_start_.assign(n + 1, 0);
+  std::vector<uint16_t> objects;
+  objects.reserve(this->listeners_.size());
+  for (const auto &listener : this->listeners_) {
+    const GroupObjectEntry *object = this->find_group_object_(listener.ga);
+    if (object == nullptr) {
+      ESP_LOGW(TAG, "No group object for listened GA %s, it is never received",
+               GroupAddress::to_string(listener.ga).c_str());
+      objects.push_back(n);
+      continue;
+    }
+    objects.push_back(object - this->group_objects_);
+    this->go_listener_start_[objects.back() + 1]++;
+  }
+  for (size_t i = 0; i < n; i++) {
+    this->go_listener_start_[i + 1] += this->go_listener_start_[i];
+  }
+  this->go_listeners_.resize(this->go_listener_start_[n]);
+  std::vector<uint16_t> next(this->go_listener_start_.begin(), this->go_listener_start_.end() - 1);
+  for (size_t k = 0; k < objects.size(); k++) {
+    if (objects[k] < n) {
+      this->go_listeners_[next[objects[k]]++] = k;
+    }
+  }
+  this->listener_table_stale_ = false;
+}
+
+void KNXIPComponent::flush_pending_values_() {
+  // Index loop: an entity may send (and loop back a value) while it publishes
+  for (size_t i = 0; i < this->dirty_listeners_.size(); i++) {
+    uint16_t ga = this->dirty_listeners_[i].first;
+    KNXListener *listener = this->dirty_listeners_[i].second;
+    if (!listener->dirty) {
+      continue;  // Superseded by a value delivered immediately
+    }
+    listener->dirty = false;
+    listener->entity->on_knx_group_value(listener->role, ga, listener->pending, listener->pending_len);
+  }
+  this->dirty_listeners_.clear();
+}
+
+void KNXIPComponent::group_object_callback_(size_t object, const uint8_t *data, uint8_t len) {
+  uint16_t ga = this->group_objects_[object].ga;
+  // Nobody listens on most GAs: one bit load, before any other receive work
+  if (!this->rx_filter_.contains(ga)) {
+    return;
+  }
+
+  if (data == nullptr) {
+    ESP_LOGE(TAG, "Null data pointer in group_object_callback_ for GA %u", ga);
+    return;
+  }
+
+  ESP_LOGV(TAG, "Group object callback for GA %u/%u/%u with %d bytes",
+           (ga >> 11) & 0x1F, (ga >> 8) & 0x07, ga & 0xFF, len);
+
+  // Hand the stack's buffer straight to the listeners (no string/vector copies)
+  this->notify_entities_(object, ga, data, len);
+}
+
+#if USE_KNX_ADDRESS_PARSER
 uint16_t KNXIPComponent::parse_physical_address_(const std::string &address) {
   // Parse format: "area.line.device" or "area/line/device"
   // Example: "1.1.200" -> 0x1100 + 200 = 0x11C8
@@ -341,5 +649,7 @@ std::vector<uint8_t> KNXIPComponent::encode_address_(const std::string &address)
   return {static_cast<uint8_t>(ga_int >> 8), static_cast<uint8_t>(ga_int & 0xFF)};
 }
 
+#endif
+
 }  // namespace knx_ip
 }  // namespace esphome
@@ -4,8 +4,10 @@
 #include "esphome/core/hal.h"
 #include "group_address.h"
 #include "dpt.h"
+#include "ga_filter.h"
 #include <vector>
 #include <string>
+#include <utility>
 
 // Define MASK_VERSION for KNX-IP before including KNX headers
 #ifndef MASK_VERSION
@@ -13,7 +15,7 @@
 #endif
 
 // Forward declarations for Thelsing KNX stack
-class Esp32IdfPlatform;
+class Platform;  // Esp32IdfPlatform on device, LinuxPlatform on the host build
 class Bau57B0;  // IP BAU (vs Bau07B0 for TP)
 
 namespace esphome {
@@ -30,6 +32,24 @@ class GroupAddress;
 class DPT;
 class KNXEntity;
 
+// Largest payload publish coalescing buffers (DPT 16.001, 14 bytes, is the
+// largest an entity decodes); longer telegrams are delivered immediately
+static constexpr uint8_t KNX_COALESCE_MAX_PAYLOAD = 14;
+
+/**
+ * Dispatch index entry: an entity listening on a group address, plus the
+ * role that address plays for it (e.g. climate setpoint vs. mode feedback)
+ */
+struct KNXListener {
+  KNXEntity *entity;
+  uint16_t ga;
+  uint8_t role;
+  // Publish coalescing: latest payload received this loop, delivered at its end
+  bool dirty;
+  uint8_t pending_len;
+  uint8_t pending[KNX_COALESCE_MAX_PAYLOAD];
+};
+
 /**
  * Main KNX IP Component
  * Handles KNX/IP communication via network (WiFi/Ethernet)
@@ -52,9 +72,27 @@ class KNXIPComponent : public Component {
   // Memory is managed by ESPHome framework and freed on device reboot
 
   // Configuration
+  // Individual address, AAAA.LLLL.DDDDDDDD (emitted by codegen as a constant)
+  void set_physical_address(uint16_t address) { physical_address_int_ = address; }
+#if USE_KNX_ADDRESS_PARSER
   void set_physical_address(const std::string &address);
+#endif
   void register_group_address(GroupAddress *ga);
+  // Group object table generated by codegen (sorted by address, constexpr)
+  void set_group_objects(const GroupObjectEntry *objects, size_t count) {
+    group_objects_ = objects;
+    group_object_count_ = count;
+  }
   void register_entity(KNXEntity *entity);
+  // Listeners receive the telegrams of a GA. Group object flags and sizes are
+  // worked out at codegen time (use_group_address() in __init__.py).
+  // Entities get their GroupAddress pointers from codegen; the string
+  // overload resolves an id first, for lambdas
+  void register_listener(GroupAddress *ga, KNXEntity *entity, uint8_t role);
+  void register_listener(const std::string &ga_id, KNXEntity *entity, uint8_t role);
+  // Publish coalescing: values received during one loop() reach each listener
+  // once, at its end, with the latest payload (bursty GAs: dimmer ramps, weather stations)
+  void set_coalesce_publish(bool coalesce) { coalesce_publish_ = coalesce; }
 
   // IP-specific configuration
   void set_gateway_ip(const std::string &ip) { gateway_ip_ = ip; }
@@ -64,27 +102,79 @@ class KNXIPComponent : public Component {
 
   // Time broadcast configuration (same as TP)
   void set_time_source(time::RealTimeClock *time_source) { time_source_ = time_source; }
-  void set_time_broadcast_ga(const std::string &ga_id) { time_broadcast_ga_id_ = ga_id; }
+  void set_time_broadcast_ga(GroupAddress *ga) { time_broadcast_ga_ = ga; }
   void set_time_broadcast_interval(uint32_t interval_ms) { time_broadcast_interval_ = interval_ms; }
 
   // Communication (same interface as TP for compatibility)
-  void send_telegram(const std::string &dest_addr, const std::vector<uint8_t> &data);
-  void send_group_write(const std::string &ga_id, const std::vector<uint8_t> &data);
+  // (pointer, length) and std::array (DPT::encode_*_fixed) overloads send without allocating.
+  // The uint16_t overloads take the raw group address (GroupAddress::get_address_int())
+  // and skip the id lookup; the string ones resolve a GA id first
+  void send_telegram(uint16_t dest, const uint8_t *data, size_t len);
+#if USE_KNX_ADDRESS_PARSER
+  void send_telegram(const std::string &dest_addr, const uint8_t *data, size_t len);
+  void send_telegram(const std::string &dest_addr, const std::vector<uint8_t> &data) {
+    this->send_telegram(dest_addr, data.data(), data.size());
+  }
+#endif
+  void send_group_write(uint16_t ga, const uint8_t *data, size_t len) { this->send_telegram(ga, data, len); }
+  template<size_t N> void send_group_write(uint16_t ga, const std::array<uint8_t, N> &data) {
+    this->send_telegram(ga, data.data(), N);
+  }
+  void send_group_write(const std::string &ga_id, const uint8_t *data, size_t len);
+  void send_group_write(const std::string &ga_id, const std::vector<uint8_t> &data) {
+    this->send_group_write(ga_id, data.data(), data.size());
+  }
+  template<size_t N> void send_group_write(const std::string &ga_id, const std::array<uint8_t, N> &data) {
+    this->send_group_write(ga_id, data.data(), N);
+  }
+  void send_group_read(uint16_t ga) { this->send_telegram(ga, nullptr, 0); }
   void send_group_read(const std::string &ga_id);
-  void send_group_response(const std::string &ga_id, const std::vector<uint8_t> &data);
+  void send_group_response(uint16_t ga, const uint8_t *data, size_t len) { this->send_telegram(ga, data, len); }
+  template<size_t N> void send_group_response(uint16_t ga, const std::array<uint8_t, N> &data) {
+    this->send_telegram(ga, data.data(), N);
+  }
+  void send_group_response(const std::string &ga_id, const uint8_t *data, size_t len);
+  void send_group_response(const std::string &ga_id, const std::vector<uint8_t> &data) {
+    this->send_group_response(ga_id, data.data(), data.size());
+  }
+  template<size_t N> void send_group_response(const std::string &ga_id, const std::array<uint8_t, N> &data) {
+    this->send_group_response(ga_id, data.data(), N);
+  }
 
   // Accessors
   GroupAddress *get_group_address(const std::string &id);
-  std::string get_physical_address() const { return physical_address_; }
+  std::string get_physical_address() const;
+  uint16_t get_physical_address_int() const { return physical_address_int_; }
   bool is_connected() const { return connected_; }
 
   // Thelsing KNX stack integration
   Bau57B0* get_bau() { return bau_; }
 
  protected:
-  std::string physical_address_;
-  std::vector<GroupAddress *> group_addresses_;
+  std::vector<GroupAddress *> group_addresses_;  // Sorted by id (binary search)
   std::vector<KNXEntity *> entities_;
+  // Legacy entities (no listeners): every telegram, through on_knx_telegram()
+  std::vector<KNXEntity *> telegram_entities_;
+  // Entities (and roles) listening on a GA, in registration order.
+  // Filled by register_listener() while entities run their setup()
+  std::vector<KNXListener> listeners_;
+  // Receive dispatch index, rebuilt on the first telegram after a registration:
+  // the listeners of group object i are listeners_[go_listeners_[k]],
+  // go_listener_start_[i] <= k < go_listener_start_[i + 1]
+  std::vector<uint16_t> go_listener_start_;
+  std::vector<uint16_t> go_listeners_;
+  bool listener_table_stale_{true};
+  void build_listener_table_();
+  // GAs with a listener or trigger: checked first on every received telegram
+  GAFilter rx_filter_;
+  // Publish coalescing: listeners holding a pending value, flushed at the end of loop()
+  bool coalesce_publish_{false};
+  std::vector<std::pair<uint16_t, KNXListener *>> dirty_listeners_;
+  void flush_pending_values_();
+  // Group objects bound to our GAs: asap N (1-based) belongs to group_objects_[N - 1].
+  // Sorted, like the address table it mirrors; lives in flash
+  const GroupObjectEntry *group_objects_{nullptr};
+  size_t group_object_count_{0};
 
   // IP-specific configuration
   std::string gateway_ip_;              // Gateway IP for tunneling (optional)
@@ -95,40 +185,64 @@ class KNXIPComponent : public Component {
 
   // Thelsing KNX stack objects
   Bau57B0 *bau_{nullptr};               // IP BAU
-  Esp32IdfPlatform *platform_{nullptr};
+  Platform *platform_{nullptr};
   uint16_t physical_address_int_{0};
 
   // Time broadcast
   time::RealTimeClock *time_source_{nullptr};
-  std::string time_broadcast_ga_id_;
+  GroupAddress *time_broadcast_ga_{nullptr};
   uint32_t time_broadcast_interval_{60000};  // Default: 60 seconds
   uint32_t last_time_broadcast_{0};
   void broadcast_time_();
 
   // Telegram processing
   void parse_telegram_(const std::vector<uint8_t> &telegram);
-  void notify_entities_(const std::string &ga, const std::vector<uint8_t> &data);
-  void group_object_callback_(uint16_t ga, const uint8_t *data, uint8_t len);
+  void notify_entities_(size_t object, uint16_t ga, const uint8_t *data, uint8_t len);
+  void group_object_callback_(size_t object, const uint8_t *data, uint8_t len);
+  bool configure_group_objects_();
+  const GroupObjectEntry *find_group_object_(uint16_t ga) const;
 
   // Utilities
+#if USE_KNX_ADDRESS_PARSER
   std::vector<uint8_t> encode_address_(const std::string &address);
   uint16_t parse_physical_address_(const std::string &address);
+#endif
 };
 
 /**
  * Base class for KNX IP entities (sensors, switches, etc.)
- * Same interface as KNX-TP for compatibility
+ * Same interface as KNX-TP for compatibility: entities subscribe with
+ * register_listener() and only receive telegrams for those addresses.
+ * Entities written against on_knx_telegram() receive every telegram
  */
 class KNXEntity {
  public:
   virtual ~KNXEntity() = default;
 
   /**
-   * Called when a KNX telegram is received
+   * Called when a KNX telegram is received on a subscribed group address
+   * The payload points into the stack's buffer (no copy) and is only valid
+   * for the duration of the call.
+   * @param role Role passed to register_listener() for this group address
    * @param ga Group address that triggered this
    * @param data Payload data from the telegram
+   * @param len Payload length in bytes
+   */
+  virtual void on_knx_group_value(uint8_t role, uint16_t ga, const uint8_t *data, uint8_t len) {
+    // Compatibility shim: forward to the legacy signature (allocates)
+    this->on_knx_telegram(GroupAddress::to_string(ga), std::vector<uint8_t>(data, data + len));
+  }
+
+  /**
+   * Legacy receive callback, with the original signature. Entities that do
+   * not use listeners (uses_listeners() false) get every telegram here, as
+   * before the dispatch index; override on_knx_group_value() instead to
+   * avoid the per-telegram string and vector.
    */
-  virtual void on_knx_telegram(const std::string &ga, const std::vector<uint8_t> &data) = 0;
+  virtual void on_knx_telegram(const std::string &ga, const std::vector<uint8_t> &data) {}
+
+  // True for entities that override on_knx_group_value() and subscribe with register_listener()
+  virtual bool uses_listeners() const { return false; }
 
   void set_knx_component(KNXIPComponent *knx) { knx_ = knx; }
 
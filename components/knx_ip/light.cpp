@@ -1,24 +1,150 @@
 #include "light.h"
 #include "dpt.h"
 #include "esphome/core/log.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 namespace esphome { namespace knx_ip {
 static constexpr const char* TAG = "knx_ip.light";
-void KNXLight::setup() { if (knx_) knx_->register_entity(this); }
+void KNXLight::setup() {
+  if (knx_) {
+    knx_->register_entity(this);
+    if (state_ga_) knx_->register_listener(state_ga_, this, ROLE_STATE);
+    if (brightness_state_ga_) knx_->register_listener(brightness_state_ga_, this, ROLE_BRIGHTNESS_STATE);
+    if (color_state_ga_ && color_dpt_) knx_->register_listener(color_state_ga_, this, ROLE_COLOR_STATE);
+  }
+}
 light::LightTraits KNXLight::get_traits() {
   auto t = light::LightTraits();
-  if (brightness_ga_id_.empty()) t.set_supported_color_modes({light::ColorMode::ON_OFF});
+  if (color_ga_) t.set_supported_color_modes({is_white_() ? light::ColorMode::RGB_WHITE : light::ColorMode::RGB});
+  else if (!brightness_ga_) t.set_supported_color_modes({light::ColorMode::ON_OFF});
   else t.set_supported_color_modes({light::ColorMode::BRIGHTNESS});
   return t;
 }
-void KNXLight::write_state(light::LightState *state) {
+bool KNXLight::update_pending_(light::LightState *state) {
+  // The actuator fades on its own: send the target once, not the steps ESPHome interpolates
+  bool actuator = transition_mode_ == TRANSITION_ACTUATOR;
+  const auto &values = actuator ? state->remote_values : state->current_values;
   bool binary; float brightness;
-  state->current_values_as_binary(&binary);
-  state->current_values_as_brightness(&brightness);
-  if (knx_) {
-    knx_->send_group_write(switch_ga_id_, DPT::encode_dpt1(binary));
-    if (!brightness_ga_id_.empty())
-      knx_->send_group_write(brightness_ga_id_, DPT::encode_dpt5_percentage(brightness * 100.0f));
+  if (actuator) {
+    binary = values.is_on();
+    values.as_brightness(&brightness, state->get_gamma_correct());
+  } else {
+    state->current_values_as_binary(&binary);
+    state->current_values_as_brightness(&brightness);
+  }
+  if (brightness_ga_) pending_brightness_ = binary ? DPT::encode_dpt5_percentage_fixed(brightness * 100.0f)[0] : 0;
+  if (color_ga_) {
+    float r, g, b, w = 0.0f;
+    if (brightness_ga_) {
+      // The actuator dims the colour itself: full-brightness colour on its own GA
+      r = values.get_red(); g = values.get_green(); b = values.get_blue(); w = values.get_white();
+    } else if (is_white_()) {
+      values.as_rgbw(&r, &g, &b, &w, state->get_gamma_correct());
+    } else {
+      values.as_rgb(&r, &g, &b, state->get_gamma_correct());
+    }
+    auto to_byte = [](float v) { return static_cast<uint8_t>(std::lround(std::min(std::max(v, 0.0f), 1.0f) * 255.0f)); };
+    DPT::Color color = {to_byte(r), to_byte(g), to_byte(b), to_byte(w), static_cast<uint8_t>(is_white_() ? 0x0F : 0x0E)};
+    DPT::encode_color(*color_dpt_, color, pending_color_);
+  }
+  return binary;
+}
+void KNXLight::write_state(light::LightState *state) {
+  if (!knx_) return;
+  bool binary = update_pending_(state);
+  bool actuator = transition_mode_ == TRANSITION_ACTUATOR;
+  // An actuator fading to a DPT 5.001 target (0 % for off) is switched by it: a switch telegram
+  // would cut its fade-out short or jump to the on brightness before the fade starts
+  bool switch_by_brightness = actuator && brightness_ga_;
+  // A transition calls this every loop: the switch value only changes on its edges
+  if (!switch_by_brightness && (!switch_sent_ || binary != last_binary_)) {
+    knx_->send_group_write(switch_ga_->get_address_int(), DPT::encode_dpt1_fixed(binary));
+    switch_sent_ = true;
+    last_binary_ = binary;
+  }
+  if (!pending_changed_()) {
+    cancel_timeout("send");  // Back to the values on the bus
+    return;
+  }
+  uint32_t now = millis();
+  if (actuator || now - last_send_time_ >= send_interval_) {
+    cancel_timeout("send");
+    send_pending_();
+  } else {
+    // Over the rate: the latest values go out when the interval is up, so a fade still ends on its target
+    set_timeout("send", send_interval_ - (now - last_send_time_), [this]() { send_pending_(); });
+  }
+}
+bool KNXLight::pending_changed_() const {
+  return (brightness_ga_ && pending_brightness_ != last_brightness_) ||
+         (color_ga_ && (!color_sent_ || memcmp(pending_color_, last_color_, color_dpt_->size()) != 0));
+}
+void KNXLight::send_pending_() {
+  // Brightness (DPT 5.001) and the whole colour (DPT 232.600 / 251.600) in one frame each
+  if (brightness_ga_ && pending_brightness_ != last_brightness_) {
+    knx_->send_group_write(brightness_ga_->get_address_int(), DPT::Bytes<DPT::DPT5_SIZE>{pending_brightness_});
+    last_brightness_ = pending_brightness_;
+  }
+  if (color_ga_ && (!color_sent_ || memcmp(pending_color_, last_color_, color_dpt_->size()) != 0)) {
+    knx_->send_group_write(color_ga_->get_address_int(), pending_color_, color_dpt_->size());
+    memcpy(last_color_, pending_color_, color_dpt_->size());
+    color_sent_ = true;
+  }
+  last_send_time_ = millis();
+}
+void KNXLight::dim_start(bool increase, uint8_t step_code) {
+  if (!knx_ || !dimming_ga_) return;
+  knx_->send_group_write(dimming_ga_->get_address_int(), DPT::encode_dpt3_fixed(increase, step_code));
+}
+void KNXLight::dim_stop() {
+  if (!knx_ || !dimming_ga_) return;
+  knx_->send_group_write(dimming_ga_->get_address_int(), DPT::encode_dpt3_fixed(false, 0));
+}
+void KNXLight::on_knx_group_value(uint8_t role, uint16_t ga, const uint8_t *data, uint8_t len) {
+  // Actuator status: where a fade or a relative dim actually ended
+  if (!state_) return;
+  if (transition_mode_ == TRANSITION_STREAM && state_->is_transformer_active()) {
+    // Actuators report while they follow our fade: let it finish instead of jumping to the report
+    ESP_LOGV(TAG, "'%s': status during transition ignored", state_->get_name().c_str());
+    return;
+  }
+  auto call = state_->make_call();
+  if (role == ROLE_BRIGHTNESS_STATE) {
+    float brightness = DPT::decode_dpt5_percentage(data, len);
+    call.set_state(brightness > 0.0f);
+    if (brightness > 0.0f) call.set_brightness(brightness / 100.0f);
+    ESP_LOGD(TAG, "'%s': brightness feedback %.1f%%", state_->get_name().c_str(), brightness);
+  } else if (role == ROLE_COLOR_STATE) {
+    DPT::Color color = DPT::decode_color(*color_dpt_, data, len);
+    if (!color.valid) return;
+    call.set_rgb(color.red / 255.0f, color.green / 255.0f, color.blue / 255.0f);
+    if (color.valid & 0x01) call.set_white(color.white / 255.0f);
+    if (!brightness_ga_) {
+      // Brightness is folded into the colour: the strongest channel carries it
+      uint8_t peak = std::max({color.red, color.green, color.blue, color.white});
+      call.set_state(peak > 0);
+      if (peak > 0) call.set_brightness(peak / 255.0f);
+    }
+    ESP_LOGD(TAG, "'%s': colour feedback R%u G%u B%u W%u", state_->get_name().c_str(), color.red, color.green,
+             color.blue, color.white);
+  } else {
+    bool on = DPT::decode_dpt1(data, len);
+    call.set_state(on);
+    ESP_LOGD(TAG, "'%s': state feedback %s", state_->get_name().c_str(), on ? "ON" : "OFF");
+  }
+  call.set_transition_length(0);
+  call.perform();
+  // A zero-length call applies its values right away: record them as already on the bus,
+  // so the write_state() that follows finds nothing to echo back
+  bool binary = update_pending_(state_);
+  switch_sent_ = true;
+  last_binary_ = binary;
+  if (brightness_ga_) last_brightness_ = pending_brightness_;
+  if (color_ga_) {
+    memcpy(last_color_, pending_color_, color_dpt_->size());
+    color_sent_ = true;
   }
+  cancel_timeout("send");
 }
-void KNXLight::on_knx_telegram(const std::string &ga, const std::vector<uint8_t> &data) {}
 }}
\ No newline at end of file
@@ -1,18 +1,65 @@
 #pragma once
 #include "esphome/components/light/light_output.h"
+#include "esphome/core/automation.h"
 #include "esphome/core/component.h"
 #include "knx_ip.h"
+#include "dpt_registry.h"
 namespace esphome { namespace knx_ip {
 class KNXLight : public light::LightOutput, public Component, public KNXEntity {
  public:
+  // Who performs transitions: ESPHome streams the steps, or the actuator ramps to the target itself
+  enum TransitionMode : uint8_t { TRANSITION_STREAM, TRANSITION_ACTUATOR };
   void setup() override;
   light::LightTraits get_traits() override;
-  void set_switch_ga_id(const std::string &ga_id) { switch_ga_id_ = ga_id; }
-  void set_brightness_ga_id(const std::string &ga_id) { brightness_ga_id_ = ga_id; }
-  void set_state_ga_id(const std::string &ga_id) { state_ga_id_ = ga_id; }
+  void setup_state(light::LightState *state) override { state_ = state; }
+  void set_switch_ga(GroupAddress *ga) { switch_ga_ = ga; }
+  void set_brightness_ga(GroupAddress *ga) { brightness_ga_ = ga; }
+  void set_state_ga(GroupAddress *ga) { state_ga_ = ga; }
+  void set_brightness_state_ga(GroupAddress *ga) { brightness_state_ga_ = ga; }
+  void set_dimming_ga(GroupAddress *ga) { dimming_ga_ = ga; }
+  // Colour in one telegram: DPT_232_600 (RGB) or DPT_251_600 (RGBW)
+  void set_color_ga(GroupAddress *ga, const DPTDescriptor *dpt) { color_ga_ = ga; color_dpt_ = dpt; }
+  void set_color_state_ga(GroupAddress *ga) { color_state_ga_ = ga; }
+  void set_transition_mode(TransitionMode mode) { transition_mode_ = mode; }
+  // Telegrams per second during transitions (0 = unlimited); the final value always goes out
+  void set_max_rate(float rate) { send_interval_ = rate > 0 ? static_cast<uint32_t>(1000.0f / rate) : 0; }
+  // Relative dimming (DPT 3.007): the actuator ramps at its own speed until dim_stop()
+  void dim_start(bool increase, uint8_t step_code = 1);
+  void dim_stop();
   void write_state(light::LightState *state) override;
-  void on_knx_telegram(const std::string &ga, const std::vector<uint8_t> &data) override;
+  void on_knx_group_value(uint8_t role, uint16_t ga, const uint8_t *data, uint8_t len) override;
+  bool uses_listeners() const override { return true; }
  protected:
-  std::string switch_ga_id_, brightness_ga_id_, state_ga_id_;
+  enum Role : uint8_t { ROLE_STATE, ROLE_BRIGHTNESS_STATE, ROLE_COLOR_STATE };
+  static constexpr size_t MAX_COLOR_SIZE = 6;  // DPT 251.600
+  GroupAddress *switch_ga_{nullptr}, *brightness_ga_{nullptr}, *state_ga_{nullptr};
+  GroupAddress *brightness_state_ga_{nullptr}, *dimming_ga_{nullptr};
+  GroupAddress *color_ga_{nullptr}, *color_state_ga_{nullptr};
+  const DPTDescriptor *color_dpt_{nullptr};
+  light::LightState *state_{nullptr};
+  TransitionMode transition_mode_{TRANSITION_STREAM};
+  // Switch telegram only on on/off edges; brightness and colour paced to send_interval_
+  bool switch_sent_{false}, last_binary_{false};
+  int16_t last_brightness_{-1};  // Last DPT 5.001 byte sent, -1 = none
+  uint8_t pending_brightness_{0};
+  bool color_sent_{false};
+  uint8_t last_color_[MAX_COLOR_SIZE]{}, pending_color_[MAX_COLOR_SIZE]{};
+  uint32_t send_interval_{100}, last_send_time_{0};
+  bool is_white_() const { return color_dpt_ != nullptr && color_dpt_->family == DPTFamily::RGBW; }
+  // Fills pending_brightness_/pending_color_ from the light's values, returns its on/off state
+  bool update_pending_(light::LightState *state);
+  bool pending_changed_() const;
+  void send_pending_();
 };
-}}
\ No newline at end of file
+// knx_ip.light.dim_start / knx_ip.light.dim_stop: relative dimming on the light's dimming_ga
+template<typename... Ts> class LightDimStartAction : public Action<Ts...>, public Parented<KNXLight> {
+ public:
+  TEMPLATABLE_VALUE(bool, increase)
+  TEMPLATABLE_VALUE(uint8_t, step_code)
+  void play(Ts... x) override { this->parent_->dim_start(this->increase_.value(x...), this->step_code_.value(x...)); }
+};
+template<typename... Ts> class LightDimStopAction : public Action<Ts...>, public Parented<KNXLight> {
+ public:
+  void play(Ts... x) override { this->parent_->dim_stop(); }
+};
+}}
@@ -1,16 +1,34 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
+from esphome import automation
 from esphome.components import light
 from esphome.const import CONF_ID, CONF_OUTPUT_ID
-from . import knx_ip_ns, KNXIPComponent, const
+from . import knx_ip_ns, KNXIPComponent, GroupAddress, use_group_address, dpt_descriptor, const
 DEPENDENCIES = ["knx_ip"]
 KNXLight = knx_ip_ns.class_("KNXLight", light.LightOutput, cg.Component)
-CONFIG_SCHEMA = light.BRIGHTNESS_ONLY_LIGHT_SCHEMA.extend({
+TransitionMode = KNXLight.enum("TransitionMode")
+LightDimStartAction = knx_ip_ns.class_("LightDimStartAction", automation.Action)
+LightDimStopAction = knx_ip_ns.class_("LightDimStopAction", automation.Action)
+CONF_INCREASE = "increase"
+CONF_STEP_CODE = "step_code"
+TRANSITION_MODES = {
+    "stream": TransitionMode.TRANSITION_STREAM,
+    "actuator": TransitionMode.TRANSITION_ACTUATOR,
+}
+# Colour effects are only meaningful with a color_ga
+CONFIG_SCHEMA = light.RGB_LIGHT_SCHEMA.extend({
     cv.GenerateID(CONF_OUTPUT_ID): cv.declare_id(KNXLight),
     cv.GenerateID("knx_id"): cv.use_id(KNXIPComponent),
-    cv.Required(const.CONF_SWITCH_GA): cv.string,
-    cv.Optional(const.CONF_BRIGHTNESS_GA): cv.string,
-    cv.Optional(const.CONF_STATE_GA): cv.string,
+    cv.Required(const.CONF_SWITCH_GA): cv.use_id(GroupAddress),
+    cv.Optional(const.CONF_BRIGHTNESS_GA): cv.use_id(GroupAddress),
+    cv.Optional(const.CONF_STATE_GA): cv.use_id(GroupAddress),
+    cv.Optional(const.CONF_BRIGHTNESS_STATE_GA): cv.use_id(GroupAddress),
+    cv.Optional(const.CONF_DIMMING_GA): cv.use_id(GroupAddress),
+    cv.Optional(const.CONF_COLOR_GA): cv.use_id(GroupAddress),
+    cv.Optional(const.CONF_COLOR_STATE_GA): cv.use_id(GroupAddress),
+    cv.Optional(const.CONF_COLOR_DPT, default="232.600"): cv.one_of(*sorted(const.DPT_COLOR)),
+    cv.Optional(const.CONF_TRANSITION_MODE, default="stream"): cv.enum(TRANSITION_MODES, lower=True),
+    cv.Optional(const.CONF_MAX_RATE, default=10.0): cv.positive_float,
 }).extend(cv.COMPONENT_SCHEMA)
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_OUTPUT_ID])
@@ -18,6 +36,49 @@ async def to_code(config):
     await light.register_light(var, config)
     knx = await cg.get_variable(config["knx_id"])
     cg.add(var.set_knx_component(knx))
-    cg.add(var.set_switch_ga_id(config[const.CONF_SWITCH_GA]))
-    if const.CONF_BRIGHTNESS_GA in config: cg.add(var.set_brightness_ga_id(config[const.CONF_BRIGHTNESS_GA]))
-    if const.CONF_STATE_GA in config: cg.add(var.set_state_ga_id(config[const.CONF_STATE_GA]))
\ No newline at end of file
+    cg.add(var.set_switch_ga(await cg.get_variable(config[const.CONF_SWITCH_GA])))
+    use_group_address(config[const.CONF_SWITCH_GA], const.GO_TRANSMIT, 1)
+    if const.CONF_BRIGHTNESS_GA in config:
+        cg.add(var.set_brightness_ga(await cg.get_variable(config[const.CONF_BRIGHTNESS_GA])))
+        use_group_address(config[const.CONF_BRIGHTNESS_GA], const.GO_TRANSMIT, 8)
+    if const.CONF_STATE_GA in config:
+        cg.add(var.set_state_ga(await cg.get_variable(config[const.CONF_STATE_GA])))
+        use_group_address(config[const.CONF_STATE_GA], const.GO_LISTEN, 1)
+    if const.CONF_BRIGHTNESS_STATE_GA in config:
+        cg.add(var.set_brightness_state_ga(await cg.get_variable(config[const.CONF_BRIGHTNESS_STATE_GA])))
+        use_group_address(config[const.CONF_BRIGHTNESS_STATE_GA], const.GO_LISTEN, 8)
+    if const.CONF_DIMMING_GA in config:
+        cg.add(var.set_dimming_ga(await cg.get_variable(config[const.CONF_DIMMING_GA])))
+        use_group_address(config[const.CONF_DIMMING_GA], const.GO_TRANSMIT, 4)
+    if const.CONF_COLOR_GA in config:
+        # RGB (232.600, 3 bytes) or RGBW (251.600, 6 bytes): the whole colour in one telegram
+        color_dpt = config[const.CONF_COLOR_DPT]
+        color_bits = const.DPT_VALUE_BITS[int(color_dpt.split(".")[0])]
+        cg.add(var.set_color_ga(await cg.get_variable(config[const.CONF_COLOR_GA]), dpt_descriptor(color_dpt)))
+        use_group_address(config[const.CONF_COLOR_GA], const.GO_TRANSMIT, color_bits)
+        if const.CONF_COLOR_STATE_GA in config:
+            cg.add(var.set_color_state_ga(await cg.get_variable(config[const.CONF_COLOR_STATE_GA])))
+            use_group_address(config[const.CONF_COLOR_STATE_GA], const.GO_LISTEN, color_bits)
+    if const.CONF_BRIGHTNESS_GA in config or const.CONF_COLOR_GA in config:
+        # Brightness and colour share the rate limit
+        cg.add(var.set_max_rate(config[const.CONF_MAX_RATE]))
+    cg.add(var.set_transition_mode(config[const.CONF_TRANSITION_MODE]))
+# Relative dimming on dimming_ga; the id is the light's output_id (the KNXLight, not the LightState)
+@automation.register_action("knx_ip.light.dim_start", LightDimStartAction, cv.Schema({
+    cv.Required(CONF_ID): cv.use_id(KNXLight),
+    cv.Optional(CONF_INCREASE, default=True): cv.templatable(cv.boolean),
+    cv.Optional(CONF_STEP_CODE, default=1): cv.templatable(cv.int_range(min=1, max=7)),
+}))
+async def light_dim_start_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    cg.add(var.set_increase(await cg.templatable(config[CONF_INCREASE], args, bool)))
+    cg.add(var.set_step_code(await cg.templatable(config[CONF_STEP_CODE], args, cg.uint8)))
+    return var
+@automation.register_action("knx_ip.light.dim_stop", LightDimStopAction, cv.Schema({
+    cv.Required(CONF_ID): cv.use_id(KNXLight),
+}))
+async def light_dim_stop_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
@@ -1,6 +1,9 @@
 #include "sensor.h"
 #include "dpt.h"
 #include "esphome/core/log.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
 
 namespace esphome {
 namespace knx_ip {
@@ -10,8 +13,17 @@ static constexpr const char* TAG = "knx_ip.sensor";
 void KNXSensor::setup() {
   ESP_LOGCONFIG(TAG, "Setting up KNX Sensor '%s'...", this->get_name().c_str());
   
+  if (this->dpt_ == nullptr) {
+    this->dpt_ = type_descriptor_(this->sensor_type_);
+  }
+#if USE_KNX_FIXED_POINT
+  this->deadband_centi_ = lroundf(this->deadband_ * 100.0f);
+  this->deadband_percent_centi_ = lroundf(this->deadband_percent_ * 100.0f);
+#endif
+
   if (this->knx_ != nullptr) {
     this->knx_->register_entity(this);
+    this->knx_->register_listener(this->state_ga_, this, 0);
     ESP_LOGD(TAG, "Registered with KNX component");
   } else {
     ESP_LOGE(TAG, "KNX component is nullptr!");
@@ -20,59 +32,104 @@ void KNXSensor::setup() {
 
 void KNXSensor::dump_config() {
   LOG_SENSOR("", "KNX Sensor", this);
-  ESP_LOGCONFIG(TAG, "  State GA: %s", this->state_ga_id_.c_str());
-  ESP_LOGCONFIG(TAG, "  Sensor Type: %s", this->sensor_type_to_string(this->sensor_type_));
+  ESP_LOGCONFIG(TAG, "  State GA: %s", this->state_ga_->get_id());
+  if (this->dpt_ != nullptr && this->dpt_->sub != 0) {
+    ESP_LOGCONFIG(TAG, "  DPT: %u.%03u %s", this->dpt_->main, this->dpt_->sub, this->dpt_->unit);
+  } else {
+    ESP_LOGCONFIG(TAG, "  Sensor Type: %s", this->sensor_type_to_string(this->sensor_type_));
+  }
+  if (this->has_deadband_) {
+    ESP_LOGCONFIG(TAG, "  Deadband: %.2f, %.1f%%", this->deadband_, this->deadband_percent_);
+  }
+  if (this->min_interval_ != 0 || this->max_interval_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Publish Interval: min %u ms, max %u ms", this->min_interval_, this->max_interval_);
+  }
 }
 
-void KNXSensor::on_knx_telegram(const std::string &ga, const std::vector<uint8_t> &data) {
-  // Check if this telegram is for our group address
-  auto our_ga = this->knx_->get_group_address(this->state_ga_id_);
-  if (our_ga == nullptr || our_ga->get_address() != ga) {
-    return;  // Not for us
-  }
-  
-  ESP_LOGD(TAG, "'%s': Received telegram on GA %s", this->get_name().c_str(), ga.c_str());
-  
-  if (data.empty()) {
+void KNXSensor::on_knx_group_value(uint8_t role, uint16_t ga, const uint8_t *data, uint8_t len) {
+  if (len == 0) {
     ESP_LOGW(TAG, "'%s': Received empty data", this->get_name().c_str());
     return;
   }
   
-  float value = 0.0f;
-  
-  // Decode based on sensor type
-  switch (this->sensor_type_) {
-    case KNX_SENSOR_TYPE_TEMPERATURE:
-    case KNX_SENSOR_TYPE_HUMIDITY:
-    case KNX_SENSOR_TYPE_BRIGHTNESS:
-    case KNX_SENSOR_TYPE_PRESSURE:
-    case KNX_SENSOR_TYPE_GENERIC_2BYTE:
-      value = DPT::decode_dpt9(data);
-      break;
-
-    case KNX_SENSOR_TYPE_PERCENTAGE:
-      value = DPT::decode_dpt5_percentage(data);
-      break;
-
-    case KNX_SENSOR_TYPE_ANGLE:
-      value = DPT::decode_dpt5_angle(data);
-      break;
-
-    case KNX_SENSOR_TYPE_GENERIC_1BYTE:
-      value = static_cast<float>(DPT::decode_dpt5(data));
-      break;
-
-    case KNX_SENSOR_TYPE_GENERIC_4BYTE:
-      value = DPT::decode_dpt14(data);
-      break;
+#if USE_KNX_FIXED_POINT
+  // DPT 14 is IEEE 754 already, only the other families need the integer path
+  if (this->dpt_->family != DPTFamily::FLOAT32) {
+    this->publish_centi_(DPT::decode_centi(*this->dpt_, data, len));
+    return;
   }
-  
-  ESP_LOGD(TAG, "'%s': Decoded value: %.2f", this->get_name().c_str(), value);
-  
-  // Publish the value
+#endif
+
+  float value = DPT::decode(*this->dpt_, data, len);
+
+  // Cyclic senders repeat the same value: drop it before any formatting
+  if (this->has_deadband_ && this->has_value_ && !this->max_interval_elapsed_()) {
+    float threshold = std::max(this->deadband_, std::fabs(this->last_value_) * this->deadband_percent_ * 0.01f);
+    if (std::fabs(value - this->last_value_) <= threshold) {
+      return;
+    }
+  }
+  this->has_value_ = true;
+  this->last_value_ = value;
+
+  ESP_LOGD(TAG, "'%s': New value: %.2f", this->get_name().c_str(), value);
+  this->publish_filtered_(value);
+}
+
+#if USE_KNX_FIXED_POINT
+void KNXSensor::publish_centi_(int32_t centi) {
+  if (this->has_deadband_ && this->has_value_ && !this->max_interval_elapsed_()) {
+    int64_t delta = std::llabs(static_cast<int64_t>(centi) - this->last_centi_);
+    int64_t threshold = std::max<int64_t>(
+        this->deadband_centi_, std::llabs(static_cast<int64_t>(this->last_centi_)) * this->deadband_percent_centi_ / 10000);
+    if (delta <= threshold) {
+      return;
+    }
+  }
+  this->has_value_ = true;
+  this->last_centi_ = centi;
+
+  uint32_t magnitude = centi < 0 ? 0u - static_cast<uint32_t>(centi) : centi;
+  ESP_LOGD(TAG, "'%s': New value: %s%u.%02u", this->get_name().c_str(), centi < 0 ? "-" : "",
+           static_cast<unsigned>(magnitude / 100), static_cast<unsigned>(magnitude % 100));
+
+  // The one float operation on the receive path: the sensor API takes a float
+  this->publish_filtered_(centi * 0.01f);
+}
+#endif
+
+void KNXSensor::publish_filtered_(float value) {
+  uint32_t now = millis();
+  if (this->min_interval_ != 0 && this->has_published_ && now - this->last_publish_ < this->min_interval_) {
+    // Too soon: keep the newest value, published when the interval ends
+    this->pending_value_ = value;
+    if (!this->pending_) {
+      this->pending_ = true;
+      this->set_timeout("min_interval", this->min_interval_ - (now - this->last_publish_), [this]() {
+        this->pending_ = false;
+        this->publish_filtered_(this->pending_value_);
+      });
+    }
+    return;
+  }
+
+  this->has_published_ = true;
+  this->last_publish_ = now;
   this->publish_state(value);
-  
-  ESP_LOGI(TAG, "'%s': New value: %.2f", this->get_name().c_str(), value);
+}
+
+const DPTDescriptor *KNXSensor::type_descriptor_(KNXSensorType type) {
+  switch (type) {
+    case KNX_SENSOR_TYPE_TEMPERATURE: return &DPT_9_001;
+    case KNX_SENSOR_TYPE_HUMIDITY: return &DPT_9_007;
+    case KNX_SENSOR_TYPE_BRIGHTNESS: return &DPT_9_004;
+    case KNX_SENSOR_TYPE_PRESSURE: return &DPT_9_006;
+    case KNX_SENSOR_TYPE_PERCENTAGE: return &DPT_5_001;
+    case KNX_SENSOR_TYPE_ANGLE: return &DPT_5_003;
+    case KNX_SENSOR_TYPE_GENERIC_1BYTE: return &DPT_5;
+    case KNX_SENSOR_TYPE_GENERIC_4BYTE: return &DPT_14;
+    default: return &DPT_9;
+  }
 }
 
 const char* KNXSensor::sensor_type_to_string(KNXSensorType type) {
@@ -2,7 +2,7 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import sensor
 from esphome.const import CONF_ID, CONF_TYPE
-from . import knx_ip_ns, KNXIPComponent, const
+from . import knx_ip_ns, validate_dpt_id, dpt_descriptor, KNXIPComponent, GroupAddress, use_group_address, const
 
 DEPENDENCIES = ["knx_ip"]
 
@@ -21,13 +21,38 @@ SENSOR_TYPES = {
     "generic_4byte": KNXSensorType.KNX_SENSOR_TYPE_GENERIC_4BYTE,
 }
 
+# Main DPT of each type (KNXSensor::type_descriptor_)
+SENSOR_TYPE_DPT = {
+    "temperature": 9,
+    "humidity": 9,
+    "brightness": 9,
+    "pressure": 9,
+    "percentage": 5,
+    "angle": 5,
+    "generic_1byte": 5,
+    "generic_2byte": 9,
+    "generic_4byte": 14,
+}
+
 CONF_KNX_ID = "knx_id"
 
+def validate_scalar_dpt(value):
+    if value in const.DPT_COLOR:
+        raise cv.Invalid(f"DPT {value} is a colour, not a sensor value")
+    return value
+
 CONFIG_SCHEMA = sensor.sensor_schema(KNXSensor).extend({
     cv.GenerateID(): cv.declare_id(KNXSensor),
     cv.GenerateID(CONF_KNX_ID): cv.use_id(KNXIPComponent),
-    cv.Required(const.CONF_STATE_GA): cv.string,
+    cv.Required(const.CONF_STATE_GA): cv.use_id(GroupAddress),
     cv.Optional(CONF_TYPE, default="generic_2byte"): cv.enum(SENSOR_TYPES, lower=True),
+    # Any scalar DPT of the registry (e.g. "7.013", "13.010"); takes precedence over type
+    cv.Optional(const.CONF_DPT): cv.All(validate_dpt_id, validate_scalar_dpt),
+    # Publish filter, checked on the decoded value
+    cv.Optional(const.CONF_DEADBAND): cv.float_range(min=0.0),
+    cv.Optional(const.CONF_DEADBAND_PERCENT): cv.float_range(min=0.0, max=100.0),
+    cv.Optional(const.CONF_MIN_INTERVAL): cv.positive_time_period_milliseconds,
+    cv.Optional(const.CONF_MAX_INTERVAL): cv.positive_time_period_milliseconds,
 }).extend(cv.COMPONENT_SCHEMA)
 
 async def to_code(config):
@@ -41,5 +66,21 @@ async def to_code(config):
     cg.add(var.set_knx_component(knx))
     
     # Set the group address and sensor type
-    cg.add(var.set_state_ga_id(config[const.CONF_STATE_GA]))
+    cg.add(var.set_state_ga(await cg.get_variable(config[const.CONF_STATE_GA])))
+    if const.CONF_DPT in config:
+        dpt_main = int(config[const.CONF_DPT].split(".")[0])
+    else:
+        dpt_main = SENSOR_TYPE_DPT[config[CONF_TYPE]]
+    use_group_address(config[const.CONF_STATE_GA], const.GO_LISTEN, const.DPT_VALUE_BITS[dpt_main])
     cg.add(var.set_sensor_type(config[CONF_TYPE]))
+    if const.CONF_DPT in config:
+        cg.add(var.set_dpt(dpt_descriptor(config[const.CONF_DPT])))
+
+    if const.CONF_DEADBAND in config:
+        cg.add(var.set_deadband(config[const.CONF_DEADBAND]))
+    if const.CONF_DEADBAND_PERCENT in config:
+        cg.add(var.set_deadband_percent(config[const.CONF_DEADBAND_PERCENT]))
+    if const.CONF_MIN_INTERVAL in config:
+        cg.add(var.set_min_interval(config[const.CONF_MIN_INTERVAL]))
+    if const.CONF_MAX_INTERVAL in config:
+        cg.add(var.set_max_interval(config[const.CONF_MAX_INTERVAL]))
@@ -12,6 +12,9 @@ void KNXSwitch::setup() {
   
   if (this->knx_ != nullptr) {
     this->knx_->register_entity(this);
+    if (this->state_ga_ != nullptr) {
+      this->knx_->register_listener(this->state_ga_, this, 0);
+    }
     ESP_LOGD(TAG, "Registered with KNX component");
   } else {
     ESP_LOGE(TAG, "KNX component is nullptr!");
@@ -20,10 +23,10 @@ void KNXSwitch::setup() {
 
 void KNXSwitch::dump_config() {
   LOG_SWITCH("", "KNX Switch", this);
-  ESP_LOGCONFIG(TAG, "  Command GA: %s", this->command_ga_id_.c_str());
+  ESP_LOGCONFIG(TAG, "  Command GA: %s", this->command_ga_->get_id());
   
-  if (!this->state_ga_id_.empty()) {
-    ESP_LOGCONFIG(TAG, "  State GA: %s", this->state_ga_id_.c_str());
+  if (this->state_ga_ != nullptr) {
+    ESP_LOGCONFIG(TAG, "  State GA: %s", this->state_ga_->get_id());
   }
   
   if (this->invert_) {
@@ -46,8 +49,8 @@ void KNXSwitch::write_state(bool state) {
            knx_state ? "ON" : "OFF");
   
   // Encode as DPT 1.001 and send
-  std::vector<uint8_t> data = DPT::encode_dpt1(knx_state);
-  this->knx_->send_group_write(this->command_ga_id_, data);
+  auto data = DPT::encode_dpt1_fixed(knx_state);
+  this->knx_->send_group_write(this->command_ga_->get_address_int(), data);
   
   // Publish the state locally
   this->publish_state(state);
@@ -55,25 +58,19 @@ void KNXSwitch::write_state(bool state) {
   ESP_LOGI(TAG, "'%s': State set to %s", this->get_name().c_str(), state ? "ON" : "OFF");
 }
 
-void KNXSwitch::on_knx_telegram(const std::string &ga, const std::vector<uint8_t> &data) {
-  // Check if this telegram is for our state feedback group address
-  if (!this->state_ga_id_.empty()) {
-    auto state_ga = this->knx_->get_group_address(this->state_ga_id_);
-    if (state_ga != nullptr && state_ga->get_address() == ga) {
-      // Decode state
-      bool knx_state = DPT::decode_dpt1(data);
-      
-      // Apply inversion if configured
-      bool state = this->invert_ ? !knx_state : knx_state;
-      
-      ESP_LOGD(TAG, "'%s': Received state feedback: %s (KNX: %s)", 
-               this->get_name().c_str(), 
-               state ? "ON" : "OFF",
-               knx_state ? "ON" : "OFF");
-      
-      this->publish_state(state);
-    }
-  }
+void KNXSwitch::on_knx_group_value(uint8_t role, uint16_t ga, const uint8_t *data, uint8_t len) {
+  // Only the state feedback group address is subscribed: decode state
+  bool knx_state = DPT::decode_dpt1(data, len);
+
+  // Apply inversion if configured
+  bool state = this->invert_ ? !knx_state : knx_state;
+
+  ESP_LOGD(TAG, "'%s': Received state feedback: %s (KNX: %s)", 
+           this->get_name().c_str(), 
+           state ? "ON" : "OFF",
+           knx_state ? "ON" : "OFF");
+
+  this->publish_state(state);
 }
 
 }  // namespace knx_ip
@@ -2,7 +2,7 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import switch
 from esphome.const import CONF_ID
-from . import knx_ip_ns, KNXIPComponent, const
+from . import knx_ip_ns, KNXIPComponent, GroupAddress, use_group_address, const
 
 DEPENDENCIES = ["knx_ip"]
 
@@ -13,8 +13,8 @@ CONF_KNX_ID = "knx_id"
 CONFIG_SCHEMA = switch.switch_schema(KNXSwitch).extend({
     cv.GenerateID(): cv.declare_id(KNXSwitch),
     cv.GenerateID(CONF_KNX_ID): cv.use_id(KNXIPComponent),
-    cv.Required(const.CONF_COMMAND_GA): cv.string,
-    cv.Optional(const.CONF_STATE_GA): cv.string,
+    cv.Required(const.CONF_COMMAND_GA): cv.use_id(GroupAddress),
+    cv.Optional(const.CONF_STATE_GA): cv.use_id(GroupAddress),
     cv.Optional(const.CONF_INVERT, default=False): cv.boolean,
 }).extend(cv.COMPONENT_SCHEMA)
 
@@ -29,11 +29,13 @@ async def to_code(config):
     cg.add(var.set_knx_component(knx))
     
     # Set the command group address
-    cg.add(var.set_command_ga_id(config[const.CONF_COMMAND_GA]))
+    cg.add(var.set_command_ga(await cg.get_variable(config[const.CONF_COMMAND_GA])))
+    use_group_address(config[const.CONF_COMMAND_GA], const.GO_TRANSMIT, 1)
     
     # Optional state feedback group address
     if const.CONF_STATE_GA in config:
-        cg.add(var.set_state_ga_id(config[const.CONF_STATE_GA]))
+        cg.add(var.set_state_ga(await cg.get_variable(config[const.CONF_STATE_GA])))
+        use_group_address(config[const.CONF_STATE_GA], const.GO_LISTEN, 1)
     
     # Optional invert
     if const.CONF_INVERT in config:
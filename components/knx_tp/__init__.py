@@ -1,15 +1,28 @@
 """KNX TP component for ESPHome."""
+import logging
+
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.const import CONF_ID, CONF_TRIGGER_ID
-from esphome.core import CORE
+from esphome.core import CORE, ID, coroutine_with_priority
 from esphome.components import uart, time
 from esphome import pins, automation
 from . import const
 
+_LOGGER = logging.getLogger(__name__)
+
 CODEOWNERS = ["@fdepalo"]
 DEPENDENCIES = ["uart"]
-AUTO_LOAD = ["binary_sensor", "switch", "sensor", "climate", "cover", "light", "text_sensor", "number"]
+
+
+def AUTO_LOAD():
+    platforms = ["binary_sensor", "switch", "sensor", "climate", "cover", "light", "text_sensor", "number"]
+    if CORE.is_host:
+        # No UART bus on the host: load uart for its headers only, the stack
+        # opens the TP-UART device itself (host_uart_path)
+        platforms.append("uart")
+    return platforms
+
 
 knx_tp_ns = cg.esphome_ns.namespace("knx_tp")
 KNXTPComponent = knx_tp_ns.class_("KNXTPComponent", cg.Component, uart.UARTDevice)
@@ -24,6 +37,10 @@ GroupAddressTrigger = knx_tp_ns.class_(
     "GroupAddressTrigger",
     automation.Trigger.template(cg.std_vector.template(cg.uint8))
 )
+# Typed variants (on_group_address with a dpt), templated on the value type
+GroupAddressValueTrigger = knx_tp_ns.class_("GroupAddressValueTrigger", automation.Trigger)
+GroupAddressValueDecoder = knx_tp_ns.class_("GroupAddressValueDecoder")
+DPT = knx_tp_ns.class_("DPT")
 
 # Add library dependency for Thelsing KNX stack
 # Use Git repository as PlatformIO registry doesn't have macOS ARM builds
@@ -55,48 +72,301 @@ def validate_knx_address(value):
         raise cv.Invalid("Invalid KNX address format")
     return f"{main}.{middle}.{sub}"
 
+def validate_group_address_pattern(value):
+    """Validate an on_group_address address: each level is a number, a range
+    or * (e.g., 1/2/3, 3/*/*, 3/2/10-40)."""
+    value = cv.string(value).replace("/", ".")
+    parts = value.split(".")
+    if len(parts) != 3:
+        raise cv.Invalid("KNX address must have 3 parts (e.g., 1.2.3)")
+    levels = []
+    count = 1
+    for part, limit in zip(parts, (31, 7, 255)):
+        try:
+            if part == "*":
+                low, high = 0, limit
+            else:
+                low, _, high = part.partition("-")
+                low = int(low)
+                high = int(high) if high else low
+        except ValueError:
+            raise cv.Invalid(f"Invalid KNX address pattern: {value}")
+        if not 0 <= low <= high <= limit:
+            raise cv.Invalid(f"Invalid KNX address pattern: {value}")
+        if (low, high) == (0, limit):
+            levels.append("*")
+        else:
+            levels.append(str(low) if low == high else f"{low}-{high}")
+        count *= high - low + 1
+    # The stack only delivers GAs with a group object, one per matched address
+    if count > const.MAX_PATTERN_GROUP_OBJECTS:
+        raise cv.Invalid(f"KNX address pattern {value.replace('.', '/')} matches {count} addresses, more than "
+                         f"{const.MAX_PATTERN_GROUP_OBJECTS}: narrow it (e.g. 3/2/*)")
+    return ".".join(levels)
+
+def group_address_pattern_ranges(pattern):
+    """Raw address ranges (low, high) covered by a validated pattern, adjacent ones merged."""
+    bounds = []
+    for part, limit in zip(pattern.split("."), (31, 7, 255)):
+        low, _, high = part.partition("-")
+        bounds.append((0, limit) if part == "*" else (int(low), int(high or low)))
+    (main_low, main_high), (middle_low, middle_high), (sub_low, sub_high) = bounds
+    ranges = []
+    for main in range(main_low, main_high + 1):
+        for middle in range(middle_low, middle_high + 1):
+            low = (main << 11) | (middle << 8) | sub_low
+            high = (main << 11) | (middle << 8) | sub_high
+            if ranges and ranges[-1][1] + 1 == low:
+                ranges[-1] = (ranges[-1][0], high)
+            else:
+                ranges.append((low, high))
+    return ranges
+
+def group_address_pattern_matches(pattern):
+    """GroupAddressMatch {mask, value, low, high} list for a validated pattern:
+    a single range when contiguous, a single mask when every level is a number
+    or *, one range per block otherwise (e.g., 3/*/10-40)."""
+    ranges = group_address_pattern_ranges(pattern)
+    if len(ranges) == 1:
+        return [(0x0000, 0x0000, ranges[0][0], ranges[0][1])]
+    parts = pattern.split(".")
+    if all(part == "*" or "-" not in part for part in parts):
+        mask = value = 0
+        for part, level_mask, shift in zip(parts, (0x1F, 0x07, 0xFF), (11, 8, 0)):
+            if part != "*":
+                mask |= level_mask << shift
+                value |= int(part) << shift
+        return [(mask, value, 0x0000, 0xFFFF)]
+    return [(0x0000, 0x0000, low, high) for low, high in ranges]
+
+def validate_physical_address(value):
+    """Validate a KNX individual address (area.line.device, e.g. 1.1.100)."""
+    value = validate_knx_address(value)
+    area, line, _ = (int(part) for part in value.split("."))
+    if area > 15 or line > 15:
+        raise cv.Invalid("Physical address area and line must be 0-15")
+    return value
+
+def group_address_to_int(address):
+    """Raw group address of a validated address: main (5 bits), middle (3), sub (8)."""
+    main, middle, sub = (int(part) for part in address.split("."))
+    return (main << 11) | (middle << 8) | sub
+
+def physical_address_to_int(address):
+    """Raw individual address of a validated address: area (4 bits), line (4), device (8)."""
+    area, line, device = (int(part) for part in address.split("."))
+    return (area << 12) | (line << 8) | device
+
+def validate_dpt(value):
+    """Validate a DPT (e.g., 9 or 9.001) and return its main number."""
+    value = cv.string(value)
+    try:
+        main = int(value.split(".")[0])
+    except ValueError:
+        raise cv.Invalid(f"Invalid DPT: {value}")
+    if main not in const.DPT_VALUE_BITS:
+        raise cv.Invalid(f"Unsupported DPT: {value}")
+    return main
+
+def validate_dpt_id(value):
+    """Validate a DPT in the registry (e.g., 9 or 9.001) and return its normalized id."""
+    value = cv.string(value)
+    try:
+        parts = [int(part) for part in value.split(".")]
+    except ValueError:
+        raise cv.Invalid(f"Invalid DPT: {value}")
+    if len(parts) == 1:
+        dpt_id = str(parts[0])
+    elif len(parts) == 2:
+        dpt_id = f"{parts[0]}.{parts[1]:03d}"
+    else:
+        raise cv.Invalid(f"Invalid DPT: {value}")
+    if dpt_id not in const.DPT_REGISTRY:
+        raise cv.Invalid(f"Unsupported DPT: {value}")
+    return dpt_id
+
+def dpt_descriptor(dpt_id):
+    """C++ expression for the address of a registry descriptor."""
+    return cg.RawExpression(f"&{const.DOMAIN}::{const.DPT_REGISTRY[dpt_id]}")
+
+def validate_trigger_dpt(value):
+    """Validate the dpt of a typed on_group_address trigger: any DPT of the
+    registry, or a time/date/string one (10, 11, 16, 19)."""
+    main = cv.string(value).split(".")[0]
+    if main in ("10", "11", "16", "19"):
+        return main
+    return validate_dpt_id(value)
+
+def trigger_value_type(dpt_id):
+    """C++ type of a typed trigger's value and the expression decoding it from data/len."""
+    dpt = f"{const.DOMAIN}::DPT"
+    main = int(dpt_id.split(".")[0])
+    if main == 1:
+        return cg.bool_, f"{dpt}::decode_dpt1(data, len)"
+    if main == 10:
+        return DPT.struct("TimeOfDay"), f"{dpt}::decode_dpt10(data, len)"
+    if main == 11:
+        return DPT.struct("Date"), f"{dpt}::decode_dpt11(data, len)"
+    if main == 16:
+        return cg.std_string, f"{dpt}::decode_dpt16(data, len)"
+    if main == 19:
+        return DPT.struct("DateTime"), f"{dpt}::decode_dpt19(data, len)"
+    descriptor = f"{const.DOMAIN}::{const.DPT_REGISTRY[dpt_id]}"
+    if main == 20:
+        return DPT.enum("HVACMode", is_class=True), f"{dpt}::decode_dpt20_102(data, len)"
+    if dpt_id in const.DPT_COLOR:
+        return DPT.struct("Color"), f"{dpt}::decode_color({descriptor}, data, len)"
+    return cg.float_, f"{dpt}::decode({descriptor}, data, len)"
+
+def validate_value_trigger(config):
+    is_pattern = "*" in config[const.CONF_ADDRESS] or "-" in config[const.CONF_ADDRESS]
+    # The stack drops telegrams whose length differs from the group object's,
+    # and the dpt is what sizes the objects a pattern creates
+    if is_pattern and const.CONF_DPT not in config:
+        raise cv.Invalid("An address pattern needs a dpt (it sizes the group object of every address it matches)")
+    if config[const.CONF_ON_CHANGE]:
+        if const.CONF_DPT not in config:
+            raise cv.Invalid("on_change needs a dpt")
+        if is_pattern:
+            raise cv.Invalid("on_change needs a single group address, not a pattern")
+    return config
+
+def use_group_address(ga_id, flags, value_bits=0):
+    """Record how an entity uses a group address: its flags (const.GO_LISTEN,
+    const.GO_TRANSMIT, ...) and value size go into the group object table."""
+    usage = CORE.data.setdefault(const.DOMAIN, {}).setdefault("ga_usage", {})
+    old_flags, old_bits = usage.get(ga_id.id, (0, 0))
+    if value_bits and old_bits and value_bits != old_bits:
+        _LOGGER.warning("Group address %s used with %u and %u bit values, keeping %u",
+                        ga_id.id, old_bits, value_bits, old_bits)
+    usage[ga_id.id] = (old_flags | flags, old_bits or value_bits)
+
+@coroutine_with_priority(-100.0)
+async def group_objects_to_code(var, config, extra_objects, listen_ranges):
+    """Emit the group object table once every entity has declared its group
+    addresses: sorted by address, constexpr (in flash), one entry per address."""
+    usage = CORE.data.get(const.DOMAIN, {}).get("ga_usage", {})
+    objects = {}
+
+    def add_object(ga, flags, bits):
+        old_flags, old_bits = objects.get(ga, (0, 0))
+        objects[ga] = (old_flags | flags, old_bits or bits)
+
+    for ga_config in config[const.CONF_GROUP_ADDRESSES]:
+        ga_id = ga_config[CONF_ID].id
+        flags, bits = usage.get(ga_id, (0, 0))
+        if const.CONF_DPT in ga_config:
+            dpt_bits = const.DPT_VALUE_BITS[ga_config[const.CONF_DPT]]
+            if bits and bits != dpt_bits:
+                _LOGGER.warning("Group address %s used with %u bit values, keeping %u from its dpt",
+                                ga_id, bits, dpt_bits)
+            bits = dpt_bits
+        # Declared but unused GAs can still be written from lambdas, and reach
+        # entities that use on_knx_telegram() rather than listeners
+        unused_flags = const.GO_TRANSMIT | const.GO_LISTEN
+        flags = flags or unused_flags
+        if ga_config[const.CONF_RESPOND_TO_READ]:
+            # The stack answers reads from the object (send_group_response() sets its value)
+            flags |= const.GO_FLAG_COMMUNICATION | const.GO_FLAG_READ
+        add_object(group_address_to_int(ga_config["address"]), flags, bits)
+    for ga, flags, bits in extra_objects:
+        add_object(ga, flags, bits)
+    # Objects of GAs inside an on_group_address pattern receive too
+    for ga, (flags, bits) in objects.items():
+        if any(low <= ga <= high for low, high in listen_ranges):
+            objects[ga] = (flags | const.GO_LISTEN, bits)
+    if not objects:
+        return
+
+    entries = []
+    for ga in sorted(objects):
+        flags, bits = objects[ga]
+        if bits == 0:
+            _LOGGER.warning("No value size known for GA %u/%u/%u, assuming 1 byte (set 'dpt' on the group address)",
+                            ga >> 11, (ga >> 8) & 0x07, ga & 0xFF)
+            bits = 8
+        entries.append(f"{{0x{ga:04X}, 0x{flags:02X}, {bits}}}")
+    table = f"{config[CONF_ID].id}_group_objects"
+    cg.add_global(cg.RawStatement(
+        f"static constexpr {const.DOMAIN}::GroupObjectEntry {table}[] = {{\n  " + ",\n  ".join(entries) + "\n};"
+    ))
+    cg.add(var.set_group_objects(cg.RawExpression(table), len(entries)))
+
 GROUP_ADDRESS_SCHEMA = cv.Schema({
     cv.Required(CONF_ID): cv.declare_id(GroupAddress),
     cv.Required("address"): validate_knx_address,
+    cv.Optional(const.CONF_DPT): validate_dpt,
+    cv.Optional(const.CONF_RESPOND_TO_READ, default=False): cv.boolean,
 })
 
 CONF_TIME_ID = "time_id"
 
-CONFIG_SCHEMA = cv.All(
+BASE_SCHEMA = (
     cv.Schema({
         cv.GenerateID(): cv.declare_id(KNXTPComponent),
-        cv.Required(const.CONF_PHYSICAL_ADDRESS): validate_knx_address,
+        cv.Required(const.CONF_PHYSICAL_ADDRESS): validate_physical_address,
         cv.Optional(const.CONF_GROUP_ADDRESSES, default=[]): cv.ensure_list(GROUP_ADDRESS_SCHEMA),
         cv.Optional(const.CONF_SAV_PIN): pins.gpio_input_pin_schema,
+        cv.Optional(const.CONF_TX_INTERVAL, default="20ms"): cv.positive_time_period_milliseconds,
+        cv.Optional(const.CONF_COALESCE_PUBLISH, default=False): cv.boolean,
+        cv.Optional(const.CONF_SEND_DEDUP_WINDOW, default="0ms"): cv.positive_time_period_milliseconds,
         cv.Optional(CONF_TIME_ID): cv.use_id(time.RealTimeClock),
-        cv.Optional(const.CONF_TIME_BROADCAST_GA): cv.string,
+        cv.Optional(const.CONF_TIME_BROADCAST_GA): cv.use_id(GroupAddress),
         cv.Optional(const.CONF_TIME_BROADCAST_INTERVAL, default="60s"): cv.positive_time_period_milliseconds,
         cv.Optional(const.CONF_ON_TELEGRAM): automation.validate_automation({
             cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(TelegramTrigger),
         }),
-        cv.Optional(const.CONF_ON_GROUP_ADDRESS): cv.ensure_list(cv.Schema({
+        cv.Optional(const.CONF_ON_GROUP_ADDRESS): cv.ensure_list(cv.All(cv.Schema({
             cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(GroupAddressTrigger),
-            cv.Required(const.CONF_ADDRESS): validate_knx_address,
+            cv.Required(const.CONF_ADDRESS): validate_group_address_pattern,
+            # With a dpt the automation gets the decoded value as x instead of data
+            cv.Optional(const.CONF_DPT): validate_trigger_dpt,
+            cv.Optional(const.CONF_ON_CHANGE, default=False): cv.boolean,
             cv.Required(automation.CONF_THEN): automation.validate_automation(single=True),
-        })),
+        }), validate_value_trigger)),
     })
     .extend(cv.COMPONENT_SCHEMA)
-    .extend(uart.UART_DEVICE_SCHEMA)
 )
 
+
+def CONFIG_SCHEMA(config):
+    # On the host platform the TP-UART is a serial device or pty, not a UART bus
+    if CORE.is_host:
+        return BASE_SCHEMA.extend({
+            cv.Required(const.CONF_HOST_UART_PATH): cv.string,
+        })(config)
+    return BASE_SCHEMA.extend(uart.UART_DEVICE_SCHEMA)(config)
+
+
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
-    await uart.register_uart_device(var, config)
+    if CORE.is_host:
+        cg.add(var.set_host_uart_path(config[const.CONF_HOST_UART_PATH]))
+    else:
+        await uart.register_uart_device(var, config)
 
-    cg.add(var.set_physical_address(config[const.CONF_PHYSICAL_ADDRESS]))
+    # Addresses are emitted as integer constants: no string parsing at boot
+    cg.add(var.set_physical_address(physical_address_to_int(config[const.CONF_PHYSICAL_ADDRESS])))
 
-    for ga_config in config[const.CONF_GROUP_ADDRESSES]:
+    # Registered in id order: the hub keeps them sorted for get_group_address()
+    for ga_config in sorted(config[const.CONF_GROUP_ADDRESSES], key=lambda ga_config: str(ga_config[CONF_ID].id)):
         ga = cg.new_Pvariable(ga_config[CONF_ID])
         cg.add(ga.set_id(str(ga_config[CONF_ID].id)))
-        cg.add(ga.set_address(ga_config["address"]))
+        cg.add(ga.set_address(group_address_to_int(ga_config["address"])))
         cg.add(var.register_group_address(ga))
 
+    # Transmit pacing (TP1 carries ~50 frames/s at 9600 baud)
+    cg.add(var.set_tx_interval(config[const.CONF_TX_INTERVAL]))
+
+    # Send deduplication: repeated identical writes within the window stay off the bus
+    if config[const.CONF_SEND_DEDUP_WINDOW].total_milliseconds > 0:
+        cg.add(var.set_send_dedup_window(config[const.CONF_SEND_DEDUP_WINDOW]))
+
+    # Publish coalescing: one entity update per loop for bursty GAs
+    if config[const.CONF_COALESCE_PUBLISH]:
+        cg.add(var.set_coalesce_publish(True))
+
     # SAV pin configuration (BCU detection)
     if const.CONF_SAV_PIN in config:
         sav_pin = await cg.gpio_pin_expression(config[const.CONF_SAV_PIN])
@@ -108,7 +378,9 @@ async def to_code(config):
         cg.add(var.set_time_source(time_source))
 
     if const.CONF_TIME_BROADCAST_GA in config:
-        cg.add(var.set_time_broadcast_ga(config[const.CONF_TIME_BROADCAST_GA]))
+        time_ga = await cg.get_variable(config[const.CONF_TIME_BROADCAST_GA])
+        cg.add(var.set_time_broadcast_ga(time_ga))
+        use_group_address(config[const.CONF_TIME_BROADCAST_GA], const.GO_TRANSMIT | const.GO_FLAG_READ, 64)
 
     if const.CONF_TIME_BROADCAST_INTERVAL in config:
         cg.add(var.set_time_broadcast_interval(config[const.CONF_TIME_BROADCAST_INTERVAL]))
@@ -118,7 +390,7 @@ async def to_code(config):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID])
         # Add lambda that calls trigger when telegram arrives
         cg.add(var.add_on_telegram_callback(
-            cg.RawExpression(f"[=](std::string ga, std::vector<uint8_t> data) {{ {trigger}->trigger(ga, data); }}")
+            cg.RawExpression(f"[=](const std::string &ga, const std::vector<uint8_t> &data) {{ {trigger}->trigger(ga, data); }}")
         ))
         # Build automation actions
         await automation.build_automation(
@@ -127,23 +399,67 @@ async def to_code(config):
             conf,
         )
 
-    # Setup on_group_address triggers (specific GA)
+    # Setup on_group_address triggers (a GA, or a pattern such as 3/*/* or 3/2/10-40)
+    # Each entry of callbacks is one hub registration: (pattern, value bits, callback)
+    callbacks = []
+    decoders = {}
     for ga_conf in config.get(const.CONF_ON_GROUP_ADDRESS, []):
-        ga_address = ga_conf[const.CONF_ADDRESS]
-        # Convert address string to integer using the same function as C++
-        parts = ga_address.split(".")
-        area, line, device = int(parts[0]), int(parts[1]), int(parts[2])
-        ga_int = ((area & 0x1F) << 11) | ((line & 0x07) << 8) | (device & 0xFF)
-
-        trigger = cg.new_Pvariable(ga_conf[CONF_TRIGGER_ID])
-        # Add lambda that calls trigger when GA matches
-        cg.add(var.add_on_group_address_callback(
-            ga_int,
-            cg.RawExpression(f"[=](std::vector<uint8_t> data) {{ {trigger}->trigger(data); }}")
-        ))
-        # Build automation actions
-        await automation.build_automation(
-            trigger,
-            [(cg.std_vector.template(cg.uint8), "data")],
-            ga_conf[automation.CONF_THEN],
-        )
+        pattern = ga_conf[const.CONF_ADDRESS]
+        if const.CONF_DPT in ga_conf:
+            # Typed trigger: the triggers of one address and DPT share a decoder,
+            # so the value is decoded once per telegram
+            dpt_id = ga_conf[const.CONF_DPT]
+            value_type, decode = trigger_value_type(dpt_id)
+            if (pattern, dpt_id) not in decoders:
+                decoder_id = ID(f"{ga_conf[CONF_TRIGGER_ID].id}_decoder", is_declaration=True,
+                                type=GroupAddressValueDecoder)
+                decoder = cg.new_Pvariable(decoder_id, cg.TemplateArguments(value_type), cg.RawExpression(
+                    f"[](const uint8_t *data, size_t len) {{ return {decode}; }}"
+                ))
+                decoders[(pattern, dpt_id)] = decoder
+                callbacks.append((pattern, const.DPT_VALUE_BITS[int(dpt_id.split(".")[0])], cg.RawExpression(
+                    f"[=](const std::vector<uint8_t> &data) {{ {decoder}->process(data); }}"
+                )))
+            ga_conf[CONF_TRIGGER_ID].type = GroupAddressValueTrigger
+            trigger = cg.new_Pvariable(ga_conf[CONF_TRIGGER_ID], cg.TemplateArguments(value_type))
+            cg.add(trigger.set_on_change(ga_conf[const.CONF_ON_CHANGE]))
+            cg.add(decoders[(pattern, dpt_id)].add_trigger(trigger))
+            await automation.build_automation(trigger, [(value_type, "x")], ga_conf[automation.CONF_THEN])
+        else:
+            trigger = cg.new_Pvariable(ga_conf[CONF_TRIGGER_ID])
+            # Add lambda that calls trigger when GA matches
+            callbacks.append((pattern, 0, cg.RawExpression(
+                f"[=](const std::vector<uint8_t> &data) {{ {trigger}->trigger(data); }}"
+            )))
+            # Build automation actions
+            await automation.build_automation(
+                trigger,
+                [(cg.std_vector.template(cg.uint8), "data")],
+                ga_conf[automation.CONF_THEN],
+            )
+
+    trigger_objects = []
+    listen_ranges = []
+    if callbacks:
+        cg.add(var.reserve_group_address_callbacks(
+            sum(len(group_address_pattern_matches(pattern)) for pattern, _, _ in callbacks)))
+    for pattern, bits, callback in callbacks:
+        if "*" not in pattern and "-" not in pattern:
+            ga_int = group_address_to_int(pattern)
+            trigger_objects.append((ga_int, const.GO_LISTEN, bits))
+            cg.add(var.add_on_group_address_callback(ga_int, callback))
+            continue
+
+        # Matched in C++ against the group objects, once at setup
+        for mask, value, low, high in group_address_pattern_matches(pattern):
+            cg.add(var.add_on_group_address_callback(cg.RawExpression(
+                f"{const.DOMAIN}::GroupAddressMatch{{0x{mask:04X}, 0x{value:04X}, 0x{low:04X}, 0x{high:04X}}}"
+            ), callback))
+        # The stack only delivers GAs with a group object: one per address, sized
+        # by the trigger's dpt (validation requires it and caps the address count)
+        ranges = group_address_pattern_ranges(pattern)
+        trigger_objects.extend((ga, const.GO_LISTEN, bits) for low, high in ranges for ga in range(low, high + 1))
+        listen_ranges.extend(ranges)
+
+    # The group object table is emitted after the entity platforms ran
+    CORE.add_job(group_objects_to_code, var, config, trigger_objects, listen_ranges)
@@ -3,6 +3,7 @@
 #include "esphome/core/automation.h"
 #include "esphome/core/component.h"
 #include "dpt.h"
+#include <cstring>
 #include <string>
 #include <vector>
 
@@ -27,6 +28,70 @@ class GroupAddressTrigger : public Trigger<std::vector<uint8_t>> {
   explicit GroupAddressTrigger() {}
 };
 
+/**
+ * Trigger for a group address with a DPT (called with the decoded value)
+ * Variables: x (bool, float, std::string, DPT::TimeOfDay, DPT::Date,
+ * DPT::DateTime, DPT::HVACMode or DPT::Color, following the dpt option)
+ */
+template<typename T> class GroupAddressValueTrigger : public Trigger<T> {
+ public:
+  explicit GroupAddressValueTrigger() {}
+
+  // Only fire when the value differs from the previous telegram
+  void set_on_change(bool on_change) { this->on_change_ = on_change; }
+  bool get_on_change() const { return this->on_change_; }
+
+ protected:
+  bool on_change_{false};
+};
+
+/**
+ * Decodes a group address value once per telegram for all the typed triggers
+ * of that address and DPT, and tells on_change triggers whether it changed
+ */
+template<typename T> class GroupAddressValueDecoder {
+ public:
+  using DecodeFunction = T (*)(const uint8_t *data, size_t len);
+
+  explicit GroupAddressValueDecoder(DecodeFunction decode) : decode_(decode) {}
+
+  void add_trigger(GroupAddressValueTrigger<T> *trigger) {
+    this->triggers_.push_back(trigger);
+    if (!trigger->get_on_change()) {
+      this->always_count_++;
+    }
+  }
+
+  void process(const std::vector<uint8_t> &data) {
+    // Same payload, same value: compare the raw bytes, T needs no operator==
+    size_t len = data.size();
+    bool changed = !this->has_last_ || len != this->last_len_ || memcmp(data.data(), this->last_, len) != 0;
+    this->has_last_ = len <= sizeof(this->last_);  // Longer payloads always count as a change
+    if (this->has_last_) {
+      memcpy(this->last_, data.data(), len);
+      this->last_len_ = len;
+    }
+    if (!changed && this->always_count_ == 0) {
+      return;  // Only on_change triggers, nothing to decode
+    }
+
+    T value = this->decode_(data.data(), len);
+    for (auto *trigger : this->triggers_) {
+      if (changed || !trigger->get_on_change()) {
+        trigger->trigger(value);
+      }
+    }
+  }
+
+ protected:
+  DecodeFunction decode_;
+  std::vector<GroupAddressValueTrigger<T> *> triggers_;
+  uint8_t always_count_{0};  // Triggers firing on every telegram
+  bool has_last_{false};
+  uint8_t last_len_{0};
+  uint8_t last_[14];  // Largest group value (DPT 16)
+};
+
 // ============================================================================
 // KNX DPT Decode Actions
 // These actions simplify DPT decoding in automations
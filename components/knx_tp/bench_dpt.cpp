@@ -0,0 +1,810 @@
+// DPT codec microbenchmarks (Google Benchmark) for both the knx_tp and knx_ip copies
+//
+// Build and run from components/knx_tp:
+//   g++ -std=gnu++17 -O2 -o bench_dpt bench_dpt.cpp dpt.cpp ../knx_ip/dpt.cpp -lbenchmark -lpthread
+//   ./bench_dpt                                        ns/op and allocs/op per codec
+//   ./bench_dpt --baseline=bench_dpt_baseline.txt      regression gate (exit code 1 on regression)
+//
+// The gate fails when a codec allocates more per op than in the baseline;
+// allocation counts are the same on every machine, so the committed baseline
+// works as is. Timings are machine specific and only compared with
+// --check_time: record your own baseline first, before the change, then
+// compare against it:
+//   ./bench_dpt --benchmark_repetitions=3 --baseline=/tmp/bench.txt --update_baseline
+//   ./bench_dpt --benchmark_repetitions=3 --baseline=/tmp/bench.txt --check_time
+// A codec then also fails when it is slower than baseline * (1 + tolerance)
+// + 2 ns (the 2 ns absorb timer and code alignment noise on the fastest
+// codecs); --tolerance=0.5 by default. With --benchmark_repetitions=N the
+// best repetition is compared, which makes the time check much steadier.
+
+#include "dpt.h"
+#include "dpt_registry.h"
+#include "../knx_ip/dpt.h"
+#include "../knx_ip/dpt_registry.h"
+#include <benchmark/benchmark.h>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using TP = esphome::knx_tp::DPT;
+using IP = esphome::knx_ip::DPT;
+
+// ---------------------------------------------------------------------------
+// Allocation counting: every operator new goes through here
+
+// GCC cannot see that these new/delete replacements pair up
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+
+static uint64_t g_allocations = 0;
+
+void *operator new(size_t size) {
+  g_allocations++;
+  if (void *p = std::malloc(size ? size : 1)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+void operator delete[](void *p, size_t) noexcept { std::free(p); }
+
+// Reports allocations per iteration as the "allocs/op" counter
+class AllocCounter {
+ public:
+  explicit AllocCounter(benchmark::State &state) : state_(state), start_(g_allocations) {}
+  ~AllocCounter() {
+    this->state_.counters["allocs/op"] =
+        benchmark::Counter(static_cast<double>(g_allocations - this->start_), benchmark::Counter::kAvgIterations);
+  }
+
+ private:
+  benchmark::State &state_;
+  uint64_t start_;
+};
+
+// ---------------------------------------------------------------------------
+// Inputs: a small rotating set so the compiler cannot fold the codec away
+
+static const float FLOAT_INPUTS[8] = {21.5f, -5.25f, 0.0f, 1234.5f, 65.0f, -273.0f, 670760.0f, 0.01f};
+static const std::array<std::vector<uint8_t>, 8> DPT9_RAW = {{
+    {0x0C, 0x33}, {0x8A, 0x24}, {0x00, 0x00}, {0x3C, 0x4B}, {0x0E, 0x59}, {0xA9, 0xAB}, {0x7F, 0xFE}, {0x00, 0x01},
+}};
+static const std::array<std::vector<uint8_t>, 8> DPT14_RAW = {{
+    {0x41, 0xAC, 0x00, 0x00}, {0xC0, 0xA8, 0x00, 0x00}, {0x00, 0x00, 0x00, 0x00}, {0x44, 0x9A, 0x50, 0x00},
+    {0x42, 0x82, 0x00, 0x00}, {0xC3, 0x88, 0x80, 0x00}, {0x49, 0x23, 0xC2, 0x80}, {0x3C, 0x23, 0xD7, 0x0A},
+}};
+static const std::vector<uint8_t> DPT16_RAW = {'K', 'N', 'X', ' ', 'g', 'a', 't', 'e', 'w', 'a', 'y', 0, 0, 0};
+static const std::vector<uint8_t> DPT10_RAW = {0x6E, 0x1E, 0x2D};
+static const std::vector<uint8_t> DPT11_RAW = {0x0F, 0x06, 0x18};
+static const std::vector<uint8_t> DPT19_RAW = {0x7C, 0x06, 0x0F, 0x6E, 0x1E, 0x2D, 0x40, 0x80};
+
+// ---------------------------------------------------------------------------
+// Benchmarks, instantiated for TP and IP below
+
+template<typename D> static void BM_encode_dpt1(benchmark::State &state) {
+  AllocCounter allocs(state);
+  bool value = false;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt1(value));
+    value = !value;
+  }
+}
+
+template<typename D> static void BM_encode_dpt1_fixed(benchmark::State &state) {
+  AllocCounter allocs(state);
+  bool value = false;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt1_fixed(value));
+    value = !value;
+  }
+}
+
+template<typename D> static void BM_decode_dpt1(benchmark::State &state) {
+  std::vector<uint8_t> raw = {0x01};
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt1(raw));
+  }
+}
+
+template<typename D> static void BM_decode_dpt1_ptr(benchmark::State &state) {
+  uint8_t raw[1] = {0x01};
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt1(raw, sizeof(raw)));
+  }
+}
+
+template<typename D> static void BM_encode_dpt5(benchmark::State &state) {
+  AllocCounter allocs(state);
+  uint8_t value = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt5(value++));
+  }
+}
+
+template<typename D> static void BM_encode_dpt5_fixed(benchmark::State &state) {
+  AllocCounter allocs(state);
+  uint8_t value = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt5_fixed(value++));
+  }
+}
+
+template<typename D> static void BM_decode_dpt5(benchmark::State &state) {
+  std::vector<uint8_t> raw = {0x80};
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt5(raw));
+  }
+}
+
+template<typename D> static void BM_decode_dpt5_ptr(benchmark::State &state) {
+  uint8_t raw[1] = {0x80};
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt5(raw, sizeof(raw)));
+  }
+}
+
+template<typename D> static void BM_encode_dpt5_percentage(benchmark::State &state) {
+  AllocCounter allocs(state);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt5_percentage(FLOAT_INPUTS[i++ & 7] * 0.1f));
+  }
+}
+
+template<typename D> static void BM_encode_dpt5_percentage_fixed(benchmark::State &state) {
+  AllocCounter allocs(state);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt5_percentage_fixed(FLOAT_INPUTS[i++ & 7] * 0.1f));
+  }
+}
+
+template<typename D> static void BM_decode_dpt5_percentage(benchmark::State &state) {
+  std::vector<uint8_t> raw = {0x80};
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt5_percentage(raw));
+  }
+}
+
+template<typename D> static void BM_decode_dpt5_percentage_ptr(benchmark::State &state) {
+  uint8_t raw[1] = {0x80};
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt5_percentage(raw, sizeof(raw)));
+  }
+}
+
+template<typename D> static void BM_encode_dpt5_angle(benchmark::State &state) {
+  AllocCounter allocs(state);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt5_angle(FLOAT_INPUTS[i++ & 7] * 0.5f));
+  }
+}
+
+template<typename D> static void BM_encode_dpt5_angle_fixed(benchmark::State &state) {
+  AllocCounter allocs(state);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt5_angle_fixed(FLOAT_INPUTS[i++ & 7] * 0.5f));
+  }
+}
+
+template<typename D> static void BM_decode_dpt5_angle(benchmark::State &state) {
+  std::vector<uint8_t> raw = {0x80};
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt5_angle(raw));
+  }
+}
+
+template<typename D> static void BM_decode_dpt5_angle_ptr(benchmark::State &state) {
+  uint8_t raw[1] = {0x80};
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt5_angle(raw, sizeof(raw)));
+  }
+}
+
+template<typename D> static void BM_encode_dpt9(benchmark::State &state) {
+  AllocCounter allocs(state);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt9(FLOAT_INPUTS[i++ & 7]));
+  }
+}
+
+template<typename D> static void BM_encode_dpt9_fixed(benchmark::State &state) {
+  AllocCounter allocs(state);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt9_fixed(FLOAT_INPUTS[i++ & 7]));
+  }
+}
+
+template<typename D> static void BM_decode_dpt9(benchmark::State &state) {
+  AllocCounter allocs(state);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt9(DPT9_RAW[i++ & 7]));
+  }
+}
+
+template<typename D> static void BM_decode_dpt9_ptr(benchmark::State &state) {
+  AllocCounter allocs(state);
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &raw = DPT9_RAW[i++ & 7];
+    benchmark::DoNotOptimize(D::decode_dpt9(raw.data(), raw.size()));
+  }
+}
+
+template<typename D> static void BM_encode_dpt14(benchmark::State &state) {
+  AllocCounter allocs(state);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt14(FLOAT_INPUTS[i++ & 7]));
+  }
+}
+
+template<typename D> static void BM_encode_dpt14_fixed(benchmark::State &state) {
+  AllocCounter allocs(state);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt14_fixed(FLOAT_INPUTS[i++ & 7]));
+  }
+}
+
+template<typename D> static void BM_decode_dpt14(benchmark::State &state) {
+  AllocCounter allocs(state);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt14(DPT14_RAW[i++ & 7]));
+  }
+}
+
+template<typename D> static void BM_decode_dpt14_ptr(benchmark::State &state) {
+  AllocCounter allocs(state);
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &raw = DPT14_RAW[i++ & 7];
+    benchmark::DoNotOptimize(D::decode_dpt14(raw.data(), raw.size()));
+  }
+}
+
+template<typename D> static void BM_encode_dpt16(benchmark::State &state) {
+  AllocCounter allocs(state);
+  const std::string value = "KNX gateway";
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt16(value));
+  }
+}
+
+template<typename D> static void BM_encode_dpt16_fixed(benchmark::State &state) {
+  AllocCounter allocs(state);
+  const std::string value = "KNX gateway";
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt16_fixed(value));
+  }
+}
+
+template<typename D> static void BM_decode_dpt16(benchmark::State &state) {
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt16(DPT16_RAW));
+  }
+}
+
+template<typename D> static void BM_decode_dpt16_ptr(benchmark::State &state) {
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt16(DPT16_RAW.data(), DPT16_RAW.size()));
+  }
+}
+
+template<typename D> static void BM_encode_dpt20_102(benchmark::State &state) {
+  AllocCounter allocs(state);
+  uint8_t mode = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt20_102(static_cast<typename D::HVACMode>(mode++ % 5)));
+  }
+}
+
+template<typename D> static void BM_encode_dpt20_102_fixed(benchmark::State &state) {
+  AllocCounter allocs(state);
+  uint8_t mode = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt20_102_fixed(static_cast<typename D::HVACMode>(mode++ % 5)));
+  }
+}
+
+template<typename D> static void BM_decode_dpt20_102(benchmark::State &state) {
+  std::vector<uint8_t> raw = {0x01};
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt20_102(raw));
+  }
+}
+
+template<typename D> static void BM_decode_dpt20_102_ptr(benchmark::State &state) {
+  uint8_t raw[1] = {0x01};
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt20_102(raw, sizeof(raw)));
+  }
+}
+
+template<typename D> static void BM_encode_dpt10(benchmark::State &state) {
+  AllocCounter allocs(state);
+  typename D::TimeOfDay time = {3, 14, 30, 45};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt10(time));
+    time.second = (time.second + 1) % 60;
+  }
+}
+
+template<typename D> static void BM_encode_dpt10_fixed(benchmark::State &state) {
+  AllocCounter allocs(state);
+  typename D::TimeOfDay time = {3, 14, 30, 45};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt10_fixed(time));
+    time.second = (time.second + 1) % 60;
+  }
+}
+
+template<typename D> static void BM_decode_dpt10(benchmark::State &state) {
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt10(DPT10_RAW));
+  }
+}
+
+template<typename D> static void BM_decode_dpt10_ptr(benchmark::State &state) {
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt10(DPT10_RAW.data(), DPT10_RAW.size()));
+  }
+}
+
+template<typename D> static void BM_encode_dpt11(benchmark::State &state) {
+  AllocCounter allocs(state);
+  typename D::Date date = {15, 6, 2024};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt11(date));
+    date.day = date.day % 28 + 1;
+  }
+}
+
+template<typename D> static void BM_encode_dpt11_fixed(benchmark::State &state) {
+  AllocCounter allocs(state);
+  typename D::Date date = {15, 6, 2024};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt11_fixed(date));
+    date.day = date.day % 28 + 1;
+  }
+}
+
+template<typename D> static void BM_decode_dpt11(benchmark::State &state) {
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt11(DPT11_RAW));
+  }
+}
+
+template<typename D> static void BM_decode_dpt11_ptr(benchmark::State &state) {
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt11(DPT11_RAW.data(), DPT11_RAW.size()));
+  }
+}
+
+template<typename D> static void BM_encode_dpt19(benchmark::State &state) {
+  AllocCounter allocs(state);
+  typename D::DateTime dt = {};
+  dt.year = 2024;
+  dt.month = 6;
+  dt.day = 15;
+  dt.day_of_week = 6;
+  dt.hour = 14;
+  dt.minute = 30;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt19(dt));
+    dt.second = (dt.second + 1) % 60;
+  }
+}
+
+template<typename D> static void BM_encode_dpt19_fixed(benchmark::State &state) {
+  AllocCounter allocs(state);
+  typename D::DateTime dt = {};
+  dt.year = 2024;
+  dt.month = 6;
+  dt.day = 15;
+  dt.day_of_week = 6;
+  dt.hour = 14;
+  dt.minute = 30;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt19_fixed(dt));
+    dt.second = (dt.second + 1) % 60;
+  }
+}
+
+template<typename D> static void BM_decode_dpt19(benchmark::State &state) {
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt19(DPT19_RAW));
+  }
+}
+
+template<typename D> static void BM_decode_dpt19_ptr(benchmark::State &state) {
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt19(DPT19_RAW.data(), DPT19_RAW.size()));
+  }
+}
+
+// Fixed-point (centi-unit) codecs
+
+static const int32_t CENTI_INPUTS[8] = {2150, -525, 0, 123450, 6500, -27300, 67076000, 1};
+
+template<typename D> static void BM_encode_dpt9_centi_fixed(benchmark::State &state) {
+  AllocCounter allocs(state);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt9_centi_fixed(CENTI_INPUTS[i++ & 7]));
+  }
+}
+
+template<typename D> static void BM_decode_dpt9_centi(benchmark::State &state) {
+  AllocCounter allocs(state);
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &raw = DPT9_RAW[i++ & 7];
+    benchmark::DoNotOptimize(D::decode_dpt9_centi(raw.data(), raw.size()));
+  }
+}
+
+template<typename D> static void BM_encode_dpt5_percentage_centi_fixed(benchmark::State &state) {
+  AllocCounter allocs(state);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt5_percentage_centi_fixed(CENTI_INPUTS[i++ & 7] / 10));
+  }
+}
+
+template<typename D> static void BM_decode_dpt5_percentage_centi(benchmark::State &state) {
+  uint8_t raw[1] = {0x80};
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt5_percentage_centi(raw, sizeof(raw)));
+  }
+}
+
+template<typename D> static void BM_encode_dpt5_angle_centi_fixed(benchmark::State &state) {
+  AllocCounter allocs(state);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt5_angle_centi_fixed(CENTI_INPUTS[i++ & 7] / 2));
+  }
+}
+
+template<typename D> static void BM_decode_dpt5_angle_centi(benchmark::State &state) {
+  uint8_t raw[1] = {0x80};
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt5_angle_centi(raw, sizeof(raw)));
+  }
+}
+
+// DPT 3.007 - Dimming control
+
+template<typename D> static void BM_encode_dpt3_fixed(benchmark::State &state) {
+  AllocCounter allocs(state);
+  uint8_t step = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_dpt3_fixed(step & 0x08, step & 0x07));
+    step++;
+  }
+}
+
+template<typename D> static void BM_decode_dpt3(benchmark::State &state) {
+  uint8_t raw[1] = {0x00};
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_dpt3(raw, sizeof(raw)));
+    raw[0] = (raw[0] + 1) & 0x0F;
+  }
+}
+
+// Generic registry codecs: one descriptor per numeric family, rotating, and
+// both colour types, taken from the registry of the same copy
+
+template<typename D> struct Registry;
+template<> struct Registry<TP> {
+  static constexpr const esphome::knx_tp::DPTDescriptor *SCALAR[8] = {
+      &esphome::knx_tp::DPT_1_001, &esphome::knx_tp::DPT_5_001,  &esphome::knx_tp::DPT_6_010,
+      &esphome::knx_tp::DPT_8_010, &esphome::knx_tp::DPT_9_001,  &esphome::knx_tp::DPT_12_001,
+      &esphome::knx_tp::DPT_13_001, &esphome::knx_tp::DPT_14_019,
+  };
+  static constexpr const esphome::knx_tp::DPTDescriptor *COLOR[2] = {&esphome::knx_tp::DPT_232_600,
+                                                                     &esphome::knx_tp::DPT_251_600};
+};
+template<> struct Registry<IP> {
+  static constexpr const esphome::knx_ip::DPTDescriptor *SCALAR[8] = {
+      &esphome::knx_ip::DPT_1_001, &esphome::knx_ip::DPT_5_001,  &esphome::knx_ip::DPT_6_010,
+      &esphome::knx_ip::DPT_8_010, &esphome::knx_ip::DPT_9_001,  &esphome::knx_ip::DPT_12_001,
+      &esphome::knx_ip::DPT_13_001, &esphome::knx_ip::DPT_14_019,
+  };
+  static constexpr const esphome::knx_ip::DPTDescriptor *COLOR[2] = {&esphome::knx_ip::DPT_232_600,
+                                                                     &esphome::knx_ip::DPT_251_600};
+};
+
+// Long enough for every scalar descriptor above (at most 4 bytes)
+static const uint8_t GENERIC_RAW[4] = {0x41, 0xAC, 0x00, 0x00};
+static const uint8_t COLOR_RAW[6] = {0xFF, 0x80, 0x40, 0x20, 0x00, 0x0F};
+
+template<typename D> static void BM_decode_generic(benchmark::State &state) {
+  AllocCounter allocs(state);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode(*Registry<D>::SCALAR[i++ & 7], GENERIC_RAW, sizeof(GENERIC_RAW)));
+  }
+}
+
+template<typename D> static void BM_decode_centi_generic(benchmark::State &state) {
+  AllocCounter allocs(state);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_centi(*Registry<D>::SCALAR[i++ & 7], GENERIC_RAW, sizeof(GENERIC_RAW)));
+  }
+}
+
+template<typename D> static void BM_encode_generic(benchmark::State &state) {
+  AllocCounter allocs(state);
+  uint8_t out[4];
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode(*Registry<D>::SCALAR[i & 7], FLOAT_INPUTS[i & 7], out));
+    benchmark::ClobberMemory();
+    i++;
+  }
+}
+
+template<typename D> static void BM_decode_color(benchmark::State &state) {
+  AllocCounter allocs(state);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::decode_color(*Registry<D>::COLOR[i++ & 1], COLOR_RAW, sizeof(COLOR_RAW)));
+  }
+}
+
+template<typename D> static void BM_encode_color(benchmark::State &state) {
+  AllocCounter allocs(state);
+  typename D::Color color = {255, 128, 64, 32, 0x0F};
+  uint8_t out[6];
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(D::encode_color(*Registry<D>::COLOR[i++ & 1], color, out));
+    benchmark::ClobberMemory();
+    color.red++;
+  }
+}
+
+#define KNX_DPT_BENCHMARKS(D) \
+  BENCHMARK_TEMPLATE(BM_encode_dpt1, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt1_fixed, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt1, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt1_ptr, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt5, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt5_fixed, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt5, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt5_ptr, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt5_percentage, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt5_percentage_fixed, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt5_percentage, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt5_percentage_ptr, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt5_angle, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt5_angle_fixed, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt5_angle, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt5_angle_ptr, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt9, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt9_fixed, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt9, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt9_ptr, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt14, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt14_fixed, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt14, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt14_ptr, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt16, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt16_fixed, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt16, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt16_ptr, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt20_102, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt20_102_fixed, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt20_102, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt20_102_ptr, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt10, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt10_fixed, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt10, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt10_ptr, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt11, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt11_fixed, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt11, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt11_ptr, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt19, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt19_fixed, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt19, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt19_ptr, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt9_centi_fixed, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt9_centi, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt5_percentage_centi_fixed, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt5_percentage_centi, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt5_angle_centi_fixed, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt5_angle_centi, D); \
+  BENCHMARK_TEMPLATE(BM_encode_dpt3_fixed, D); \
+  BENCHMARK_TEMPLATE(BM_decode_dpt3, D); \
+  BENCHMARK_TEMPLATE(BM_decode_generic, D); \
+  BENCHMARK_TEMPLATE(BM_decode_centi_generic, D); \
+  BENCHMARK_TEMPLATE(BM_encode_generic, D); \
+  BENCHMARK_TEMPLATE(BM_decode_color, D); \
+  BENCHMARK_TEMPLATE(BM_encode_color, D)
+
+KNX_DPT_BENCHMARKS(TP);
+KNX_DPT_BENCHMARKS(IP);
+
+// ---------------------------------------------------------------------------
+// Regression gate
+
+struct BenchResult {
+  double ns_per_op;
+  double allocs_per_op;
+};
+
+// Console output as usual, plus the results kept for the gate
+class GateReporter : public benchmark::ConsoleReporter {
+ public:
+  void ReportRuns(const std::vector<Run> &runs) override {
+    for (const auto &run : runs) {
+      if (run.error_occurred || run.run_type != Run::RT_Iteration) {
+        continue;
+      }
+      auto allocs = run.counters.find("allocs/op");
+      BenchResult result = {run.GetAdjustedRealTime(), allocs != run.counters.end() ? allocs->second.value : 0.0};
+      // Keep the best repetition
+      auto it = this->results.find(run.benchmark_name());
+      if (it == this->results.end() || result.ns_per_op < it->second.ns_per_op) {
+        this->results[run.benchmark_name()] = result;
+      }
+    }
+    benchmark::ConsoleReporter::ReportRuns(runs);
+  }
+
+  std::map<std::string, BenchResult> results;
+};
+
+// Baseline format: one "<name> <ns/op> <allocs/op>" line per benchmark
+static std::map<std::string, BenchResult> load_baseline(const std::string &path) {
+  std::map<std::string, BenchResult> baseline;
+  std::ifstream file(path);
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream fields(line);
+    std::string name;
+    BenchResult result;
+    if (fields >> name >> result.ns_per_op >> result.allocs_per_op) {
+      baseline[name] = result;
+    }
+  }
+  return baseline;
+}
+
+static bool save_baseline(const std::string &path, const std::map<std::string, BenchResult> &results) {
+  FILE *file = fopen(path.c_str(), "w");
+  if (file == nullptr) {
+    return false;
+  }
+  fprintf(file, "# DPT codec benchmark baseline: <name> <ns/op> <allocs/op>\n");
+  for (const auto &it : results) {
+    fprintf(file, "%s %.2f %.2f\n", it.first.c_str(), it.second.ns_per_op, it.second.allocs_per_op);
+  }
+  fclose(file);
+  return true;
+}
+
+static constexpr double NOISE_FLOOR_NS = 2.0;
+
+static int run_gate(const std::map<std::string, BenchResult> &results,
+                    const std::map<std::string, BenchResult> &baseline, bool check_time, double tolerance) {
+  int regressions = 0;
+  if (check_time) {
+    printf("\nRegression gate (allocs/op, ns/op with tolerance %.0f%%):\n", tolerance * 100.0);
+  } else {
+    printf("\nRegression gate (allocs/op):\n");
+  }
+  for (const auto &it : results) {
+    auto base = baseline.find(it.first);
+    if (base == baseline.end()) {
+      printf("  NEW   %s\n", it.first.c_str());
+      continue;
+    }
+    const BenchResult &now = it.second;
+    const BenchResult &before = base->second;
+    if (now.allocs_per_op > before.allocs_per_op + 0.01) {
+      printf("  FAIL  %s: %.2f allocs/op (baseline %.2f)\n", it.first.c_str(), now.allocs_per_op,
+             before.allocs_per_op);
+      regressions++;
+    } else if (check_time && now.ns_per_op > before.ns_per_op * (1.0 + tolerance) + NOISE_FLOOR_NS) {
+      printf("  FAIL  %s: %.2f ns/op (baseline %.2f)\n", it.first.c_str(), now.ns_per_op, before.ns_per_op);
+      regressions++;
+    }
+  }
+  if (regressions == 0) {
+    printf("  OK: no regressions against %zu baseline entries\n", baseline.size());
+  }
+  return regressions;
+}
+
+int main(int argc, char **argv) {
+  // Our own flags first; the rest goes to Google Benchmark
+  std::string baseline_path;
+  bool update_baseline = false;
+  bool check_time = false;
+  double tolerance = 0.5;
+  std::vector<char *> args;
+  for (int i = 0; i < argc; i++) {
+    if (strncmp(argv[i], "--baseline=", 11) == 0) {
+      baseline_path = argv[i] + 11;
+    } else if (strcmp(argv[i], "--update_baseline") == 0) {
+      update_baseline = true;
+    } else if (strcmp(argv[i], "--check_time") == 0) {
+      check_time = true;
+    } else if (strncmp(argv[i], "--tolerance=", 12) == 0) {
+      tolerance = atof(argv[i] + 12);
+    } else {
+      args.push_back(argv[i]);
+    }
+  }
+  int bench_argc = args.size();
+  benchmark::Initialize(&bench_argc, args.data());
+  if (benchmark::ReportUnrecognizedArguments(bench_argc, args.data())) {
+    return 1;
+  }
+
+  GateReporter reporter;
+  benchmark::RunSpecifiedBenchmarks(&reporter);
+  benchmark::Shutdown();
+
+  if (baseline_path.empty()) {
+    return 0;
+  }
+  if (update_baseline) {
+    if (!save_baseline(baseline_path, reporter.results)) {
+      fprintf(stderr, "Cannot write %s\n", baseline_path.c_str());
+      return 1;
+    }
+    printf("\nBaseline written to %s\n", baseline_path.c_str());
+    return 0;
+  }
+  auto baseline = load_baseline(baseline_path);
+  if (baseline.empty()) {
+    fprintf(stderr, "No baseline in %s (create it with --update_baseline)\n", baseline_path.c_str());
+    return 1;
+  }
+  return run_gate(reporter.results, baseline, check_time, tolerance) == 0 ? 0 : 1;
+}
@@ -12,6 +12,7 @@ void KNXBinarySensor::setup() {
   
   if (this->knx_ != nullptr) {
     this->knx_->register_entity(this);
+    this->knx_->register_listener(this->state_ga_, this, 0);
     ESP_LOGD(TAG, "Registered with KNX component");
   } else {
     ESP_LOGE(TAG, "KNX component is nullptr!");
@@ -20,7 +21,7 @@ void KNXBinarySensor::setup() {
 
 void KNXBinarySensor::dump_config() {
   LOG_BINARY_SENSOR("", "KNX Binary Sensor", this);
-  ESP_LOGCONFIG(TAG, "  State GA: %s", this->state_ga_id_.c_str());
+  ESP_LOGCONFIG(TAG, "  State GA: %s", this->state_ga_->get_id());
   
   if (this->invert_) {
     ESP_LOGCONFIG(TAG, "  Inverted: YES");
@@ -31,17 +32,12 @@ void KNXBinarySensor::dump_config() {
   }
 }
 
-void KNXBinarySensor::on_knx_telegram(const std::string &ga, const std::vector<uint8_t> &data) {
-  // Check if this telegram is for our group address
-  auto our_ga = this->knx_->get_group_address(this->state_ga_id_);
-  if (our_ga == nullptr || our_ga->get_address() != ga) {
-    return;  // Not for us
-  }
-  
-  ESP_LOGD(TAG, "'%s': Received telegram on GA %s", this->get_name().c_str(), ga.c_str());
+void KNXBinarySensor::on_knx_group_value(uint8_t role, uint16_t ga, const uint8_t *data, uint8_t len) {
+  ESP_LOGD(TAG, "'%s': Received telegram on GA %u/%u/%u", this->get_name().c_str(),
+           (ga >> 11) & 0x1F, (ga >> 8) & 0x07, ga & 0xFF);
   
   // Decode DPT 1.001 (boolean)
-  bool state = DPT::decode_dpt1(data);
+  bool state = DPT::decode_dpt1(data, len);
   
   ESP_LOGD(TAG, "'%s': Decoded state: %s", this->get_name().c_str(), state ? "ON" : "OFF");
   
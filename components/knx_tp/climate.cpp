@@ -10,32 +10,53 @@ static constexpr const char* TAG = "knx_tp.climate";
 void KNXClimate::setup() {
   if (this->knx_ != nullptr) {
     this->knx_->register_entity(this);
+
+    // Subscribe to every configured feedback group address
+    // (setpoint, mode and presets are also sent from control())
+    this->knx_->register_listener(this->temperature_ga_, this, ROLE_TEMPERATURE);
+    this->knx_->register_listener(this->setpoint_ga_, this, ROLE_SETPOINT);
+    auto listen = [this](GroupAddress *ga, Role role) {
+      if (ga != nullptr) {
+        this->knx_->register_listener(ga, this, role);
+      }
+    };
+    listen(this->mode_ga_, ROLE_MODE);
+    listen(this->action_ga_, ROLE_ACTION);
+    listen(this->preset_comfort_ga_, ROLE_PRESET_COMFORT);
+    listen(this->preset_eco_ga_, ROLE_PRESET_ECO);
+    listen(this->preset_away_ga_, ROLE_PRESET_AWAY);
+    listen(this->preset_sleep_ga_, ROLE_PRESET_SLEEP);
+    listen(this->preset_mode_ga_, ROLE_PRESET_MODE);
+
     ESP_LOGD(TAG, "KNX Climate registered");
   }
 }
 
 void KNXClimate::dump_config() {
   LOG_CLIMATE("", "KNX Climate", this);
-  ESP_LOGCONFIG(TAG, "  Temperature GA: %s", this->temperature_ga_id_.c_str());
-  ESP_LOGCONFIG(TAG, "  Setpoint GA: %s", this->setpoint_ga_id_.c_str());
+  ESP_LOGCONFIG(TAG, "  Temperature GA: %s", this->temperature_ga_->get_id());
+  ESP_LOGCONFIG(TAG, "  Setpoint GA: %s", this->setpoint_ga_->get_id());
 
-  if (!this->mode_ga_id_.empty()) {
-    ESP_LOGCONFIG(TAG, "  Mode GA: %s", this->mode_ga_id_.c_str());
+  if (this->mode_ga_ != nullptr) {
+    ESP_LOGCONFIG(TAG, "  Mode GA: %s", this->mode_ga_->get_id());
   }
-  if (!this->action_ga_id_.empty()) {
-    ESP_LOGCONFIG(TAG, "  Action GA: %s", this->action_ga_id_.c_str());
+  if (this->action_ga_ != nullptr) {
+    ESP_LOGCONFIG(TAG, "  Action GA: %s", this->action_ga_->get_id());
   }
-  if (!this->preset_comfort_ga_id_.empty()) {
-    ESP_LOGCONFIG(TAG, "  Preset Comfort GA: %s", this->preset_comfort_ga_id_.c_str());
+  if (this->preset_comfort_ga_ != nullptr) {
+    ESP_LOGCONFIG(TAG, "  Preset Comfort GA: %s", this->preset_comfort_ga_->get_id());
   }
-  if (!this->preset_eco_ga_id_.empty()) {
-    ESP_LOGCONFIG(TAG, "  Preset Eco GA: %s", this->preset_eco_ga_id_.c_str());
+  if (this->preset_eco_ga_ != nullptr) {
+    ESP_LOGCONFIG(TAG, "  Preset Eco GA: %s", this->preset_eco_ga_->get_id());
   }
-  if (!this->preset_away_ga_id_.empty()) {
-    ESP_LOGCONFIG(TAG, "  Preset Away GA: %s", this->preset_away_ga_id_.c_str());
+  if (this->preset_away_ga_ != nullptr) {
+    ESP_LOGCONFIG(TAG, "  Preset Away GA: %s", this->preset_away_ga_->get_id());
   }
-  if (!this->preset_sleep_ga_id_.empty()) {
-    ESP_LOGCONFIG(TAG, "  Preset Sleep GA: %s", this->preset_sleep_ga_id_.c_str());
+  if (this->preset_sleep_ga_ != nullptr) {
+    ESP_LOGCONFIG(TAG, "  Preset Sleep GA: %s", this->preset_sleep_ga_->get_id());
+  }
+  if (this->preset_mode_ga_ != nullptr) {
+    ESP_LOGCONFIG(TAG, "  Preset Mode GA: %s", this->preset_mode_ga_->get_id());
   }
 }
 
@@ -53,16 +74,21 @@ climate::ClimateTraits KNXClimate::traits() {
   });
 
   // Action support
-  if (!this->action_ga_id_.empty()) {
+  if (this->action_ga_ != nullptr) {
     traits.set_supports_action(true);
   }
 
   // Preset support
   std::set<climate::ClimatePreset> presets;
-  if (!this->preset_comfort_ga_id_.empty()) presets.insert(climate::CLIMATE_PRESET_COMFORT);
-  if (!this->preset_eco_ga_id_.empty()) presets.insert(climate::CLIMATE_PRESET_ECO);
-  if (!this->preset_away_ga_id_.empty()) presets.insert(climate::CLIMATE_PRESET_AWAY);
-  if (!this->preset_sleep_ga_id_.empty()) presets.insert(climate::CLIMATE_PRESET_SLEEP);
+  if (this->preset_comfort_ga_ != nullptr) presets.insert(climate::CLIMATE_PRESET_COMFORT);
+  if (this->preset_eco_ga_ != nullptr) presets.insert(climate::CLIMATE_PRESET_ECO);
+  if (this->preset_away_ga_ != nullptr) presets.insert(climate::CLIMATE_PRESET_AWAY);
+  if (this->preset_sleep_ga_ != nullptr) presets.insert(climate::CLIMATE_PRESET_SLEEP);
+  if (this->preset_mode_ga_ != nullptr) {
+    // One DPT 20.102 value covers all of them
+    presets.insert({climate::CLIMATE_PRESET_COMFORT, climate::CLIMATE_PRESET_ECO, climate::CLIMATE_PRESET_SLEEP,
+                    climate::CLIMATE_PRESET_AWAY});
+  }
 
   if (!presets.empty()) {
     traits.set_supported_presets(presets);
@@ -101,51 +127,33 @@ void KNXClimate::control(const climate::ClimateCall &call) {
   this->publish_state();
 }
 
-void KNXClimate::on_knx_telegram(const std::string &ga, const std::vector<uint8_t> &data) {
-  // Null pointer check: ensure KNX component is initialized
-  if (!this->knx_) {
-    ESP_LOGE(TAG, "KNX component is nullptr in on_knx_telegram");
-    return;
-  }
-
-  auto temp_ga = this->knx_->get_group_address(this->temperature_ga_id_);
-  auto setpoint_ga = this->knx_->get_group_address(this->setpoint_ga_id_);
-
-  // Check temperature feedback
-  if (temp_ga && temp_ga->get_address() == ga) {
-    this->current_temperature = DPT::decode_dpt9(data);
-    ESP_LOGD(TAG, "Received current temperature: %.1f°C", this->current_temperature);
-    this->publish_state();
-    return;
-  }
+void KNXClimate::on_knx_group_value(uint8_t role, uint16_t ga, const uint8_t *data, uint8_t len) {
+  switch (role) {
+    case ROLE_TEMPERATURE:
+      this->current_temperature = DPT::decode_dpt9(data, len);
+      ESP_LOGD(TAG, "Received current temperature: %.1f°C", this->current_temperature);
+      this->publish_state();
+      break;
 
-  // Check setpoint feedback
-  if (setpoint_ga && setpoint_ga->get_address() == ga) {
-    this->target_temperature = DPT::decode_dpt9(data);
-    ESP_LOGD(TAG, "Received target temperature: %.1f°C", this->target_temperature);
-    this->publish_state();
-    return;
-  }
+    case ROLE_SETPOINT:
+      this->target_temperature = DPT::decode_dpt9(data, len);
+      ESP_LOGD(TAG, "Received target temperature: %.1f°C", this->target_temperature);
+      this->publish_state();
+      break;
 
-  // Check mode feedback
-  if (!this->mode_ga_id_.empty()) {
-    auto mode_ga = this->knx_->get_group_address(this->mode_ga_id_);
-    if (mode_ga && mode_ga->get_address() == ga) {
-      auto hvac_mode = DPT::decode_dpt20_102(data);
+    case ROLE_MODE: {
+      auto hvac_mode = DPT::decode_dpt20_102(data, len);
+      this->last_hvac_mode_ = static_cast<uint8_t>(hvac_mode);
       this->mode = hvac_mode_to_climate_mode_(static_cast<uint8_t>(hvac_mode));
       ESP_LOGD(TAG, "Received HVAC mode: %d -> Climate mode: %d",
                static_cast<int>(hvac_mode), static_cast<int>(this->mode));
       this->publish_state();
-      return;
+      break;
     }
-  }
 
-  // Check action feedback
-  if (!this->action_ga_id_.empty()) {
-    auto action_ga = this->knx_->get_group_address(this->action_ga_id_);
-    if (action_ga && action_ga->get_address() == ga) {
+    case ROLE_ACTION: {
       // Action is typically a boolean: 0=idle, 1=active
-      bool active = DPT::decode_dpt1(data);
+      bool active = DPT::decode_dpt1(data, len);
       if (active) {
         // Determine action based on mode
         if (this->mode == climate::CLIMATE_MODE_HEAT) {
@@ -160,88 +168,163 @@ void KNXClimate::on_knx_telegram(const std::string &ga, const std::vector<uint8_
       }
       ESP_LOGD(TAG, "Received action state: %s", active ? "ACTIVE" : "IDLE");
       this->publish_state();
-      return;
+      break;
     }
-  }
 
-  // Check preset feedback
-  auto check_preset = [&](const std::string &preset_ga_id, climate::ClimatePreset preset_type) {
-    if (!preset_ga_id.empty()) {
-      auto preset_ga = this->knx_->get_group_address(preset_ga_id);
-      if (preset_ga && preset_ga->get_address() == ga) {
-        bool active = DPT::decode_dpt1(data);
-        if (active) {
-          this->preset = preset_type;
-          ESP_LOGD(TAG, "Preset activated: %d", static_cast<int>(preset_type));
-          this->publish_state();
-        }
-        return true;
-      }
+    case ROLE_PRESET_COMFORT:
+      this->on_preset_feedback_(SLOT_COMFORT, climate::CLIMATE_PRESET_COMFORT, data, len);
+      break;
+    case ROLE_PRESET_ECO:
+      this->on_preset_feedback_(SLOT_ECO, climate::CLIMATE_PRESET_ECO, data, len);
+      break;
+    case ROLE_PRESET_AWAY:
+      this->on_preset_feedback_(SLOT_AWAY, climate::CLIMATE_PRESET_AWAY, data, len);
+      break;
+    case ROLE_PRESET_SLEEP:
+      this->on_preset_feedback_(SLOT_SLEEP, climate::CLIMATE_PRESET_SLEEP, data, len);
+      break;
+
+    case ROLE_PRESET_MODE: {
+      uint8_t hvac_mode = static_cast<uint8_t>(DPT::decode_dpt20_102(data, len));
+      this->last_preset_mode_ = hvac_mode;
+      auto preset = hvac_mode_to_preset_(hvac_mode);
+      this->preset = preset;
+      ESP_LOGD(TAG, "Received preset HVAC mode: %u -> preset %d", hvac_mode, static_cast<int>(preset));
+      this->publish_state();
+      break;
     }
-    return false;
-  };
+  }
+}
 
-  if (check_preset(this->preset_comfort_ga_id_, climate::CLIMATE_PRESET_COMFORT)) return;
-  if (check_preset(this->preset_eco_ga_id_, climate::CLIMATE_PRESET_ECO)) return;
-  if (check_preset(this->preset_away_ga_id_, climate::CLIMATE_PRESET_AWAY)) return;
-  if (check_preset(this->preset_sleep_ga_id_, climate::CLIMATE_PRESET_SLEEP)) return;
+void KNXClimate::on_preset_feedback_(PresetSlot slot, climate::ClimatePreset preset_type, const uint8_t *data,
+                                     uint8_t len) {
+  bool active = DPT::decode_dpt1(data, len);
+  this->preset_states_[slot] = active;
+  if (active) {
+    this->preset = preset_type;
+    ESP_LOGD(TAG, "Preset activated: %d", static_cast<int>(preset_type));
+    this->publish_state();
+  }
 }
 
 void KNXClimate::send_temperature_(float temp) {
   if (this->knx_) {
-    auto data = DPT::encode_dpt9(temp);
-    this->knx_->send_group_write(this->setpoint_ga_id_, data);
+    auto data = DPT::encode_dpt9_fixed(temp);
+    this->knx_->send_group_write(this->setpoint_ga_->get_address_int(), data);
     ESP_LOGD(TAG, "Sent setpoint: %.1f°C", temp);
   }
 }
 
 void KNXClimate::send_mode_(climate::ClimateMode mode) {
-  if (this->knx_ && !this->mode_ga_id_.empty()) {
+  if (this->knx_ && this->mode_ga_ != nullptr) {
     uint8_t hvac_mode = climate_mode_to_hvac_mode_(mode);
+    if (hvac_mode == this->last_hvac_mode_) {
+      return;  // e.g. HEAT -> COOL: both are COMFORT on the bus
+    }
     auto hvac_mode_enum = static_cast<DPT::HVACMode>(hvac_mode);
-    auto data = DPT::encode_dpt20_102(hvac_mode_enum);
-    this->knx_->send_group_write(this->mode_ga_id_, data);
+    auto data = DPT::encode_dpt20_102_fixed(hvac_mode_enum);
+    this->knx_->send_group_write(this->mode_ga_->get_address_int(), data);
+    this->last_hvac_mode_ = hvac_mode;
     ESP_LOGD(TAG, "Sent HVAC mode: %d", hvac_mode);
   }
 }
 
+GroupAddress *KNXClimate::preset_slot_ga_(uint8_t slot) const {
+  switch (slot) {
+    case SLOT_COMFORT:
+      return this->preset_comfort_ga_;
+    case SLOT_ECO:
+      return this->preset_eco_ga_;
+    case SLOT_AWAY:
+      return this->preset_away_ga_;
+    case SLOT_SLEEP:
+      return this->preset_sleep_ga_;
+    default:
+      return nullptr;
+  }
+}
+
 void KNXClimate::send_preset_(climate::ClimatePreset preset) {
   if (!this->knx_) return;
 
-  // Deactivate all presets first (send OFF to all)
-  auto send_preset_off = [&](const std::string &preset_ga_id) {
-    if (!preset_ga_id.empty()) {
-      this->knx_->send_group_write(preset_ga_id, DPT::encode_dpt1(false));
+  // Preferred: the whole preset in one DPT 20.102 telegram, when it changes
+  if (this->preset_mode_ga_ != nullptr) {
+    uint8_t hvac_mode = preset_to_hvac_mode_(preset);
+    if (hvac_mode != this->last_preset_mode_) {
+      this->knx_->send_group_write(this->preset_mode_ga_->get_address_int(),
+                                   DPT::encode_dpt20_102_fixed(static_cast<DPT::HVACMode>(hvac_mode)));
+      this->last_preset_mode_ = hvac_mode;
+      ESP_LOGD(TAG, "Sent preset: %d (HVAC mode %u)", static_cast<int>(preset), hvac_mode);
     }
-  };
-
-  send_preset_off(this->preset_comfort_ga_id_);
-  send_preset_off(this->preset_eco_ga_id_);
-  send_preset_off(this->preset_away_ga_id_);
-  send_preset_off(this->preset_sleep_ga_id_);
+    return;
+  }
 
-  // Activate selected preset
-  std::string active_preset_ga;
+  int active_slot;
   switch (preset) {
     case climate::CLIMATE_PRESET_COMFORT:
-      active_preset_ga = this->preset_comfort_ga_id_;
+      active_slot = SLOT_COMFORT;
       break;
     case climate::CLIMATE_PRESET_ECO:
-      active_preset_ga = this->preset_eco_ga_id_;
+      active_slot = SLOT_ECO;
       break;
     case climate::CLIMATE_PRESET_AWAY:
-      active_preset_ga = this->preset_away_ga_id_;
+      active_slot = SLOT_AWAY;
       break;
     case climate::CLIMATE_PRESET_SLEEP:
-      active_preset_ga = this->preset_sleep_ga_id_;
+      active_slot = SLOT_SLEEP;
+      break;
+    default:
+      active_slot = SLOT_COUNT;  // No preset: all of them off
       break;
+  }
+
+  // Presets already in the wanted state cost no telegram
+  auto write_slot = [this](uint8_t slot, bool on) {
+    GroupAddress *ga = this->preset_slot_ga_(slot);
+    if (ga != nullptr && this->preset_states_[slot] != on) {
+      this->knx_->send_group_write(ga->get_address_int(), DPT::encode_dpt1_fixed(on));
+      this->preset_states_[slot] = on;
+    }
+  };
+
+  // Switch off the presets that are (or may be) on, then switch on the selected one
+  for (uint8_t slot = 0; slot < SLOT_COUNT; slot++) {
+    if (slot != active_slot) {
+      write_slot(slot, false);
+    }
+  }
+  write_slot(active_slot, true);
+  ESP_LOGD(TAG, "Sent preset: %d", static_cast<int>(preset));
+}
+
+uint8_t KNXClimate::preset_to_hvac_mode_(climate::ClimatePreset preset) {
+  // ESPHome presets -> KNX HVAC modes (DPT 20.102)
+  switch (preset) {
+    case climate::CLIMATE_PRESET_COMFORT:
+      return 1;  // COMFORT
+    case climate::CLIMATE_PRESET_ECO:
+      return 2;  // STANDBY
+    case climate::CLIMATE_PRESET_SLEEP:
+      return 3;  // NIGHT (economy)
+    case climate::CLIMATE_PRESET_AWAY:
+      return 4;  // FROST_PROTECTION (building protection)
     default:
-      return;
+      return 0;  // AUTO
   }
+}
 
-  if (!active_preset_ga.empty()) {
-    this->knx_->send_group_write(active_preset_ga, DPT::encode_dpt1(true));
-    ESP_LOGD(TAG, "Sent preset: %d", static_cast<int>(preset));
+climate::ClimatePreset KNXClimate::hvac_mode_to_preset_(uint8_t hvac_mode) {
+  switch (hvac_mode) {
+    case 1:
+      return climate::CLIMATE_PRESET_COMFORT;
+    case 2:
+      return climate::CLIMATE_PRESET_ECO;
+    case 3:
+      return climate::CLIMATE_PRESET_SLEEP;
+    case 4:
+      return climate::CLIMATE_PRESET_AWAY;
+    default:
+      return climate::CLIMATE_PRESET_NONE;
   }
 }
 
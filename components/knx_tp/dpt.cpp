@@ -2,49 +2,102 @@
 #include <cstring>
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 
 namespace esphome {
 namespace knx_tp {
 
 // DPT 1.xxx - Boolean
 bool DPT::decode_dpt1(const std::vector<uint8_t> &data) {
-  if (data.empty()) return false;
+  return decode_dpt1(data.data(), data.size());
+}
+
+bool DPT::decode_dpt1(const uint8_t *data, size_t len) {
+  if (len == 0) return false;
   return (data[0] & 0x01) != 0;
 }
 
-std::vector<uint8_t> DPT::encode_dpt1(bool value) {
+DPT::Bytes<DPT::DPT1_SIZE> DPT::encode_dpt1_fixed(bool value) {
   return {value ? (uint8_t)0x01 : (uint8_t)0x00};
 }
 
+std::vector<uint8_t> DPT::encode_dpt1(bool value) {
+  auto raw = encode_dpt1_fixed(value);
+  return {raw.begin(), raw.end()};
+}
+
+// DPT 3.007 - Control dimming
+DPT::DimmingControl DPT::decode_dpt3(const uint8_t *data, size_t len) {
+  if (len == 0) return {false, 0};
+  return {(data[0] & 0x08) != 0, static_cast<uint8_t>(data[0] & 0x07)};
+}
+
+DPT::Bytes<DPT::DPT3_SIZE> DPT::encode_dpt3_fixed(bool increase, uint8_t step_code) {
+  return {static_cast<uint8_t>((increase ? 0x08 : 0x00) | (step_code & 0x07))};
+}
+
 // DPT 5.xxx - 8-bit unsigned
 uint8_t DPT::decode_dpt5(const std::vector<uint8_t> &data) {
-  if (data.empty()) return 0;
+  return decode_dpt5(data.data(), data.size());
+}
+
+uint8_t DPT::decode_dpt5(const uint8_t *data, size_t len) {
+  if (len == 0) return 0;
   return data[0];
 }
 
-std::vector<uint8_t> DPT::encode_dpt5(uint8_t value) {
+DPT::Bytes<DPT::DPT5_SIZE> DPT::encode_dpt5_fixed(uint8_t value) {
   return {value};
 }
 
+std::vector<uint8_t> DPT::encode_dpt5(uint8_t value) {
+  auto raw = encode_dpt5_fixed(value);
+  return {raw.begin(), raw.end()};
+}
+
 // DPT 5.001 - Percentage
 float DPT::decode_dpt5_percentage(const std::vector<uint8_t> &data) {
-  if (data.empty()) return 0.0f;
+  return decode_dpt5_percentage(data.data(), data.size());
+}
+
+float DPT::decode_dpt5_percentage(const uint8_t *data, size_t len) {
+  if (len == 0) return 0.0f;
   return (data[0] * 100.0f) / 255.0f;
 }
 
-std::vector<uint8_t> DPT::encode_dpt5_percentage(float value) {
+DPT::Bytes<DPT::DPT5_SIZE> DPT::encode_dpt5_percentage_fixed(float value) {
   value = clamp(value, 0.0f, 100.0f);
   uint8_t scaled = static_cast<uint8_t>(std::round(value * 255.0f / 100.0f));
   return {scaled};
 }
 
+std::vector<uint8_t> DPT::encode_dpt5_percentage(float value) {
+  auto raw = encode_dpt5_percentage_fixed(value);
+  return {raw.begin(), raw.end()};
+}
+
+int32_t DPT::decode_dpt5_percentage_centi(const uint8_t *data, size_t len) {
+  if (len == 0) return 0;
+  return (data[0] * 10000 + 127) / 255;
+}
+
+DPT::Bytes<DPT::DPT5_SIZE> DPT::encode_dpt5_percentage_centi_fixed(int32_t centi) {
+  if (centi < 0) centi = 0;
+  if (centi > 10000) centi = 10000;
+  return {static_cast<uint8_t>((centi * 255 + 5000) / 10000)};
+}
+
 // DPT 5.003 - Angle
 float DPT::decode_dpt5_angle(const std::vector<uint8_t> &data) {
-  if (data.empty()) return 0.0f;
+  return decode_dpt5_angle(data.data(), data.size());
+}
+
+float DPT::decode_dpt5_angle(const uint8_t *data, size_t len) {
+  if (len == 0) return 0.0f;
   return (data[0] * 360.0f) / 255.0f;
 }
 
-std::vector<uint8_t> DPT::encode_dpt5_angle(float value) {
+DPT::Bytes<DPT::DPT5_SIZE> DPT::encode_dpt5_angle_fixed(float value) {
   // Validate input: check for NaN and Infinity to prevent infinite loops
   if (!std::isfinite(value)) {
     return {0};  // Return 0 degrees for invalid values
@@ -57,64 +110,117 @@ std::vector<uint8_t> DPT::encode_dpt5_angle(float value) {
   return {scaled};
 }
 
+std::vector<uint8_t> DPT::encode_dpt5_angle(float value) {
+  auto raw = encode_dpt5_angle_fixed(value);
+  return {raw.begin(), raw.end()};
+}
+
+int32_t DPT::decode_dpt5_angle_centi(const uint8_t *data, size_t len) {
+  if (len == 0) return 0;
+  return (data[0] * 36000 + 127) / 255;
+}
+
+DPT::Bytes<DPT::DPT5_SIZE> DPT::encode_dpt5_angle_centi_fixed(int32_t centi) {
+  // Normalize angle to 0-360 range
+  centi %= 36000;
+  if (centi < 0) centi += 36000;
+  return {static_cast<uint8_t>((centi * 255 + 18000) / 36000)};
+}
+
 // DPT 9.xxx - 2-byte float
+// 0.01 * 2^exponent and 2^-exponent, so neither direction shifts or divides
+static const float DPT9_SCALE[16] = {0.01f, 0.02f, 0.04f, 0.08f, 0.16f, 0.32f, 0.64f, 1.28f,
+                                     2.56f, 5.12f, 10.24f, 20.48f, 40.96f, 81.92f, 163.84f, 327.68f};
+static const float DPT9_INV_POW2[16] = {1.0f, 0.5f, 0.25f, 0.125f, 0.0625f, 0.03125f, 0.015625f, 0.0078125f,
+                                        0.00390625f, 0.001953125f, 0.0009765625f, 0.00048828125f,
+                                        0.000244140625f, 0.0001220703125f, 0.00006103515625f, 0.000030517578125f};
+// DPT 9 range in centi-units: -2048 * 2^15 to 2047 * 2^15
+static constexpr float DPT9_MIN_SCALED = -67108864.0f;
+static constexpr float DPT9_MAX_SCALED = 67076096.0f;
+static constexpr int32_t DPT9_MIN_CENTI = -67108864;
+static constexpr int32_t DPT9_MAX_CENTI = 67076096;
+
+static inline int32_t round_half_away(float value) {
+  return static_cast<int32_t>(value + (value < 0.0f ? -0.5f : 0.5f));
+}
+
 float DPT::decode_dpt9(const std::vector<uint8_t> &data) {
+  return decode_dpt9(data.data(), data.size());
+}
+
+float DPT::decode_dpt9(const uint8_t *data, size_t len) {
   // Strict validation: need exactly 2 bytes for DPT 9
-  if (data.size() < 2 || data.empty()) return 0.0f;
+  if (len < 2) return 0.0f;
 
-  // Safe cast to uint16_t with explicit cast
+  // Encoding: MEEEEMMM MMMMMMMM, value = 0.01 * M * 2^E, M 12-bit two's complement
   uint16_t raw = (static_cast<uint16_t>(data[0]) << 8) | static_cast<uint16_t>(data[1]);
-  
-  // Extract mantissa (11 bits) and exponent (4 bits)
-  int16_t mantissa = raw & 0x7FF;
-  uint8_t exponent = (raw >> 11) & 0x0F;
-  
-  // Check sign bit
-  if (raw & 0x8000) {
-    // Negative value: two's complement
-    mantissa = -(~(mantissa - 1) & 0x7FF);
-  }
-  
-  // Calculate value: mantissa * 2^exponent * 0.01
-  return (0.01f * mantissa) * (1 << exponent);
+
+  // The sign bit weighs -2048 in the mantissa
+  int32_t mantissa = static_cast<int32_t>(raw & 0x7FF) - static_cast<int32_t>((raw & 0x8000) >> 4);
+  return mantissa * DPT9_SCALE[(raw >> 11) & 0x0F];
 }
 
-std::vector<uint8_t> DPT::encode_dpt9(float value) {
+DPT::Bytes<DPT::DPT9_SIZE> DPT::encode_dpt9_fixed(float value) {
   // Validate input: check for NaN and Infinity
   if (!std::isfinite(value)) {
     return {0x00, 0x00};  // Return zero for invalid values
   }
 
-  // Clamp to DPT 9 valid range BEFORE multiplication to prevent overflow
-  // DPT 9 range: -671088.64 to 670760.96
-  if (value < -671088.64f) value = -671088.64f;
-  if (value > 670760.96f) value = 670760.96f;
+  // Work in centi-units, clamped to the DPT 9 range (-671088.64 to 670760.96)
+  float scaled = clamp(value * 100.0f, DPT9_MIN_SCALED, DPT9_MAX_SCALED);
 
-  // Use int32_t to avoid overflow during scaling
-  int32_t mantissa32 = static_cast<int32_t>(value * 100.0f);
-  uint8_t exponent = 0;
+  // Smallest exponent that fits the mantissa in 12 bits, from one bit scan:
+  // ~whole for negatives, so -2048 still needs only 11 magnitude bits
+  int32_t whole = static_cast<int32_t>(scaled);
+  uint32_t magnitude = static_cast<uint32_t>(whole ^ (whole >> 31)) | 1;
+  int32_t exponent = (32 - __builtin_clz(magnitude)) - 11;
+  exponent = exponent < 0 ? 0 : exponent;
 
-  // Scale mantissa to fit in 11 bits (-2048 to 2047)
-  // Use division instead of shift for portability with negative numbers
-  while ((mantissa32 < -2048 || mantissa32 > 2047) && exponent < 15) {
-    mantissa32 = mantissa32 / 2;
+  int32_t mantissa = round_half_away(scaled * DPT9_INV_POW2[exponent]);
+  if (mantissa > 2047 || mantissa < -2048) {
+    // Rounding carried into the next power of two
     exponent++;
+    mantissa = round_half_away(scaled * DPT9_INV_POW2[exponent]);
   }
 
-  // Safe cast to int16_t after scaling
-  int16_t mantissa = static_cast<int16_t>(mantissa32);
+  uint16_t raw = (mantissa < 0 ? 0x8000 : 0x0000) | (exponent << 11) | (mantissa & 0x7FF);
+  return {
+    static_cast<uint8_t>(raw >> 8),
+    static_cast<uint8_t>(raw & 0xFF)
+  };
+}
 
-  // Final clamp (should not be needed after division loop)
-  if (mantissa < -2048) mantissa = -2048;
-  if (mantissa > 2047) mantissa = 2047;
-  
-  // Encode: MEEEEMMM MMMMMMMM
-  // M = sign bit, E = exponent, M = mantissa
-  uint16_t raw = ((exponent & 0x0F) << 11) | (mantissa & 0x7FF);
-  if (mantissa < 0) {
-    raw |= 0x8000;  // Set sign bit
+std::vector<uint8_t> DPT::encode_dpt9(float value) {
+  auto raw = encode_dpt9_fixed(value);
+  return {raw.begin(), raw.end()};
+}
+
+int32_t DPT::decode_dpt9_centi(const uint8_t *data, size_t len) {
+  if (len < 2) return 0;
+
+  uint16_t raw = (static_cast<uint16_t>(data[0]) << 8) | static_cast<uint16_t>(data[1]);
+  int32_t mantissa = static_cast<int32_t>(raw & 0x7FF) - static_cast<int32_t>((raw & 0x8000) >> 4);
+  return mantissa * (1 << ((raw >> 11) & 0x0F));
+}
+
+DPT::Bytes<DPT::DPT9_SIZE> DPT::encode_dpt9_centi_fixed(int32_t centi) {
+  if (centi < DPT9_MIN_CENTI) centi = DPT9_MIN_CENTI;
+  if (centi > DPT9_MAX_CENTI) centi = DPT9_MAX_CENTI;
+
+  // Same exponent search as encode_dpt9_fixed(); the shifts are arithmetic,
+  // so adding half a step first rounds to nearest (ties up)
+  uint32_t magnitude = static_cast<uint32_t>(centi ^ (centi >> 31)) | 1;
+  int32_t exponent = (32 - __builtin_clz(magnitude)) - 11;
+  exponent = exponent < 0 ? 0 : exponent;
+
+  int32_t mantissa = (centi + ((1 << exponent) >> 1)) >> exponent;
+  if (mantissa > 2047) {
+    // Rounding carried into the next power of two
+    exponent++;
+    mantissa = (centi + (1 << (exponent - 1))) >> exponent;
   }
-  
+
+  uint16_t raw = (mantissa < 0 ? 0x8000 : 0x0000) | (exponent << 11) | (mantissa & 0x7FF);
   return {
     static_cast<uint8_t>(raw >> 8),
     static_cast<uint8_t>(raw & 0xFF)
@@ -123,7 +229,11 @@ std::vector<uint8_t> DPT::encode_dpt9(float value) {
 
 // DPT 14.xxx - 4-byte float
 float DPT::decode_dpt14(const std::vector<uint8_t> &data) {
-  if (data.size() < 4) return 0.0f;
+  return decode_dpt14(data.data(), data.size());
+}
+
+float DPT::decode_dpt14(const uint8_t *data, size_t len) {
+  if (len < 4) return 0.0f;
   
   // IEEE 754 single precision float
   uint32_t raw = (data[0] << 24) | (data[1] << 16) | (data[2] << 8) | data[3];
@@ -132,7 +242,7 @@ float DPT::decode_dpt14(const std::vector<uint8_t> &data) {
   return value;
 }
 
-std::vector<uint8_t> DPT::encode_dpt14(float value) {
+DPT::Bytes<DPT::DPT14_SIZE> DPT::encode_dpt14_fixed(float value) {
   // IEEE 754 single precision float
   uint32_t raw;
   memcpy(&raw, &value, sizeof(float));
@@ -145,15 +255,25 @@ std::vector<uint8_t> DPT::encode_dpt14(float value) {
   };
 }
 
+std::vector<uint8_t> DPT::encode_dpt14(float value) {
+  auto raw = encode_dpt14_fixed(value);
+  return {raw.begin(), raw.end()};
+}
+
 // DPT 16.001 - Character string (max 14 characters per KNX spec)
 std::string DPT::decode_dpt16(const std::vector<uint8_t> &data) {
+  return decode_dpt16(data.data(), data.size());
+}
+
+std::string DPT::decode_dpt16(const uint8_t *data, size_t len) {
   constexpr size_t MAX_DPT16_LENGTH = 14;
 
   std::string result;
-  result.reserve(std::min(data.size(), MAX_DPT16_LENGTH));
+  result.reserve(std::min(len, MAX_DPT16_LENGTH));
 
   size_t count = 0;
-  for (uint8_t byte : data) {
+  for (size_t i = 0; i < len; i++) {
+    uint8_t byte = data[i];
     if (byte == 0 || count >= MAX_DPT16_LENGTH) break;  // Null terminator or max length
 
     // Validate printable ASCII characters (0x20-0x7E)
@@ -188,9 +308,29 @@ std::vector<uint8_t> DPT::encode_dpt16(const std::string &value) {
   return result;
 }
 
+DPT::Bytes<DPT::DPT16_SIZE> DPT::encode_dpt16_fixed(const std::string &value) {
+  // Fixed 14-byte frame, zero padded; same character filtering as encode_dpt16()
+  Bytes<DPT16_SIZE> result{};
+
+  size_t count = 0;
+  for (char c : value) {
+    if (count >= DPT16_SIZE) break;
+
+    if (c >= 0x20 && c <= 0x7E) {
+      result[count++] = static_cast<uint8_t>(c);
+    }
+  }
+
+  return result;
+}
+
 // DPT 20.102 - HVAC Mode
 DPT::HVACMode DPT::decode_dpt20_102(const std::vector<uint8_t> &data) {
-  if (data.empty()) return HVACMode::AUTO;
+  return decode_dpt20_102(data.data(), data.size());
+}
+
+DPT::HVACMode DPT::decode_dpt20_102(const uint8_t *data, size_t len) {
+  if (len == 0) return HVACMode::AUTO;
 
   uint8_t mode = data[0];
   if (mode <= static_cast<uint8_t>(HVACMode::FROST_PROTECTION)) {
@@ -200,18 +340,27 @@ DPT::HVACMode DPT::decode_dpt20_102(const std::vector<uint8_t> &data) {
   return HVACMode::AUTO;
 }
 
-std::vector<uint8_t> DPT::encode_dpt20_102(HVACMode mode) {
+DPT::Bytes<DPT::DPT20_SIZE> DPT::encode_dpt20_102_fixed(HVACMode mode) {
   return {static_cast<uint8_t>(mode)};
 }
 
+std::vector<uint8_t> DPT::encode_dpt20_102(HVACMode mode) {
+  auto raw = encode_dpt20_102_fixed(mode);
+  return {raw.begin(), raw.end()};
+}
+
 // DPT 10.001 - Time of Day (3 bytes)
 // Format: Byte 0: day_of_week(3 bits) + hour(5 bits)
 //         Byte 1: reserved(2 bits) + minute(6 bits)
 //         Byte 2: reserved(2 bits) + second(6 bits)
 DPT::TimeOfDay DPT::decode_dpt10(const std::vector<uint8_t> &data) {
+  return decode_dpt10(data.data(), data.size());
+}
+
+DPT::TimeOfDay DPT::decode_dpt10(const uint8_t *data, size_t len) {
   TimeOfDay time = {0, 0, 0, 0};
 
-  if (data.size() < 3) return time;
+  if (len < 3) return time;
 
   // Byte 0: bits 7-5 = day of week, bits 4-0 = hour
   time.day_of_week = (data[0] >> 5) & 0x07;
@@ -226,7 +375,7 @@ DPT::TimeOfDay DPT::decode_dpt10(const std::vector<uint8_t> &data) {
   return time;
 }
 
-std::vector<uint8_t> DPT::encode_dpt10(const TimeOfDay &time) {
+DPT::Bytes<DPT::DPT10_SIZE> DPT::encode_dpt10_fixed(const TimeOfDay &time) {
   // Clamp values to valid ranges
   uint8_t dow = time.day_of_week & 0x07;  // 0-7
   uint8_t hour = time.hour > 23 ? 23 : time.hour;
@@ -240,15 +389,24 @@ std::vector<uint8_t> DPT::encode_dpt10(const TimeOfDay &time) {
   };
 }
 
+std::vector<uint8_t> DPT::encode_dpt10(const TimeOfDay &time) {
+  auto raw = encode_dpt10_fixed(time);
+  return {raw.begin(), raw.end()};
+}
+
 // DPT 11.001 - Date (3 bytes)
 // Format: Byte 0: day (1-31)
 //         Byte 1: month (1-12)
 //         Byte 2: year (0-99)
 //         Year encoding: 0-89 = 2000-2089, 90-99 = 1990-1999
 DPT::Date DPT::decode_dpt11(const std::vector<uint8_t> &data) {
+  return decode_dpt11(data.data(), data.size());
+}
+
+DPT::Date DPT::decode_dpt11(const uint8_t *data, size_t len) {
   Date date = {1, 1, 2000};
 
-  if (data.size() < 3) return date;
+  if (len < 3) return date;
 
   date.day = data[0];
   date.month = data[1];
@@ -264,7 +422,7 @@ DPT::Date DPT::decode_dpt11(const std::vector<uint8_t> &data) {
   return date;
 }
 
-std::vector<uint8_t> DPT::encode_dpt11(const Date &date) {
+DPT::Bytes<DPT::DPT11_SIZE> DPT::encode_dpt11_fixed(const Date &date) {
   // Clamp values
   uint8_t day = date.day;
   if (day < 1) day = 1;
@@ -288,6 +446,11 @@ std::vector<uint8_t> DPT::encode_dpt11(const Date &date) {
   return {day, month, year_byte};
 }
 
+std::vector<uint8_t> DPT::encode_dpt11(const Date &date) {
+  auto raw = encode_dpt11_fixed(date);
+  return {raw.begin(), raw.end()};
+}
+
 // DPT 19.001 - Date and Time (8 bytes)
 // Format: Bytes 0-1: year (1990-2089)
 //         Byte 2: month (1-12)
@@ -297,15 +460,14 @@ std::vector<uint8_t> DPT::encode_dpt11(const Date &date) {
 //         Byte 6: second (0-59)
 //         Byte 7: fault/quality flags
 DPT::DateTime DPT::decode_dpt19(const std::vector<uint8_t> &data) {
+  return decode_dpt19(data.data(), data.size());
+}
+
+DPT::DateTime DPT::decode_dpt19(const uint8_t *data, size_t len) {
   DateTime dt = {2000, 1, 1, 0, 0, 0, 0, 0, false, false, false, false, false, false, false, false};
 
   // Strict validation: DPT 19.001 requires exactly 8 bytes
-  if (data.size() != 8 || data.empty()) return dt;
-
-  // Defensive: verify each index is accessible
-  for (size_t i = 0; i < 8; i++) {
-    if (i >= data.size()) return dt;  // Safety check
-  }
+  if (len != 8) return dt;
 
   // Bytes 0-1: year (safe cast)
   dt.year = (static_cast<uint16_t>(data[0]) << 8) | static_cast<uint16_t>(data[1]);
@@ -349,7 +511,7 @@ DPT::DateTime DPT::decode_dpt19(const std::vector<uint8_t> &data) {
   return dt;
 }
 
-std::vector<uint8_t> DPT::encode_dpt19(const DateTime &dt) {
+DPT::Bytes<DPT::DPT19_SIZE> DPT::encode_dpt19_fixed(const DateTime &dt) {
   // Clamp values
   uint16_t year = dt.year;
   if (year < 1990) year = 1990;
@@ -391,6 +553,177 @@ std::vector<uint8_t> DPT::encode_dpt19(const DateTime &dt) {
   };
 }
 
+std::vector<uint8_t> DPT::encode_dpt19(const DateTime &dt) {
+  auto raw = encode_dpt19_fixed(dt);
+  return {raw.begin(), raw.end()};
+}
+
+// Generic codecs
+// Integer families are big-endian, 1 to 4 bytes
+static uint32_t read_be(const uint8_t *data, size_t size) {
+  uint32_t raw = 0;
+  for (size_t i = 0; i < size; i++) {
+    raw = (raw << 8) | data[i];
+  }
+  return raw;
+}
+
+static void write_be(uint32_t raw, uint8_t *out, size_t size) {
+  for (size_t i = size; i > 0; i--) {
+    out[i - 1] = raw & 0xFF;
+    raw >>= 8;
+  }
+}
+
+// Raw integer of an UNSIGNED/SIGNED descriptor, sign extended
+static int64_t read_integer(const DPTDescriptor &dpt, const uint8_t *data) {
+  size_t size = dpt.size();
+  uint32_t raw = read_be(data, size);
+  if (dpt.family == DPTFamily::SIGNED) {
+    uint32_t sign = 1u << (size * 8 - 1);
+    return static_cast<int64_t>(raw ^ sign) - sign;
+  }
+  return raw;
+}
+
+float DPT::decode(const DPTDescriptor &dpt, const uint8_t *data, size_t len) {
+  if (len < dpt.size()) return 0.0f;
+
+  switch (dpt.family) {
+    case DPTFamily::BOOLEAN:
+      return (data[0] & 0x01) ? 1.0f : 0.0f;
+    case DPTFamily::UNSIGNED:
+    case DPTFamily::SIGNED:
+      return static_cast<float>(read_integer(dpt, data)) * dpt.scale_num / dpt.scale_den;
+    case DPTFamily::FLOAT16:
+      return decode_dpt9(data, len);
+    case DPTFamily::FLOAT32:
+      return decode_dpt14(data, len);
+    case DPTFamily::SCENE_NUMBER:
+      return data[0] & 0x3F;
+    case DPTFamily::SCENE_CONTROL:
+      return data[0] & 0xBF;
+    default:
+      return 0.0f;  // Colour: decode_color()
+  }
+}
+
+int32_t DPT::decode_centi(const DPTDescriptor &dpt, const uint8_t *data, size_t len) {
+  if (len < dpt.size()) return 0;
+
+  int64_t centi;
+  switch (dpt.family) {
+    case DPTFamily::UNSIGNED:
+    case DPTFamily::SIGNED: {
+      // Round to nearest, away from zero on ties
+      int64_t scaled = read_integer(dpt, data) * dpt.scale_num * 100;
+      int64_t half = dpt.scale_den / 2;
+      centi = (scaled + (scaled < 0 ? -half : half)) / dpt.scale_den;
+      break;
+    }
+    case DPTFamily::FLOAT16:
+      return decode_dpt9_centi(data, len);
+    case DPTFamily::FLOAT32: {
+      // Already a float on the wire: no integer path to take
+      float scaled = std::round(decode_dpt14(data, len) * 100.0f);
+      if (std::isnan(scaled)) return 0;
+      if (scaled >= 2147483648.0f) return INT32_MAX;
+      if (scaled <= -2147483648.0f) return INT32_MIN;
+      return static_cast<int32_t>(scaled);
+    }
+    default:
+      centi = static_cast<int64_t>(decode(dpt, data, len)) * 100;
+      break;
+  }
+  if (centi > INT32_MAX) return INT32_MAX;
+  if (centi < INT32_MIN) return INT32_MIN;
+  return static_cast<int32_t>(centi);
+}
+
+size_t DPT::encode(const DPTDescriptor &dpt, float value, uint8_t *out) {
+  if (!std::isfinite(value)) value = 0.0f;
+  value = clamp(value, dpt.min, dpt.max);
+
+  switch (dpt.family) {
+    case DPTFamily::BOOLEAN:
+      out[0] = value != 0.0f ? 0x01 : 0x00;
+      break;
+    case DPTFamily::UNSIGNED:
+    case DPTFamily::SIGNED: {
+      // Saturate to the raw range: the float limits of 32-bit types round up
+      size_t bits = dpt.size() * 8;
+      int64_t lo = dpt.family == DPTFamily::SIGNED ? -(int64_t(1) << (bits - 1)) : 0;
+      int64_t hi = dpt.family == DPTFamily::SIGNED ? (int64_t(1) << (bits - 1)) - 1 : (int64_t(1) << bits) - 1;
+      float scaled = std::round(value * dpt.scale_den / dpt.scale_num);
+      int64_t raw;
+      if (scaled >= static_cast<float>(hi)) {
+        raw = hi;
+      } else if (scaled <= static_cast<float>(lo)) {
+        raw = lo;
+      } else {
+        raw = static_cast<int64_t>(scaled);
+      }
+      write_be(static_cast<uint32_t>(raw), out, dpt.size());
+      break;
+    }
+    case DPTFamily::FLOAT16: {
+      auto raw = encode_dpt9_fixed(value);
+      memcpy(out, raw.data(), raw.size());
+      break;
+    }
+    case DPTFamily::FLOAT32: {
+      auto raw = encode_dpt14_fixed(value);
+      memcpy(out, raw.data(), raw.size());
+      break;
+    }
+    case DPTFamily::SCENE_NUMBER:
+      out[0] = static_cast<uint8_t>(std::round(value)) & 0x3F;
+      break;
+    case DPTFamily::SCENE_CONTROL:
+      out[0] = static_cast<uint8_t>(std::round(value)) & 0xBF;
+      break;
+    default:
+      return 0;  // Colour: encode_color()
+  }
+  return dpt.size();
+}
+
+DPT::Color DPT::decode_color(const DPTDescriptor &dpt, const uint8_t *data, size_t len) {
+  Color color = {0, 0, 0, 0, 0};
+  if (len < dpt.size()) return color;
+
+  if (dpt.family == DPTFamily::RGB) {
+    color = {data[0], data[1], data[2], 0, 0x0E};
+  } else if (dpt.family == DPTFamily::RGBW) {
+    // Byte 4 reserved, byte 5: validity of R, G, B, W in bits 3-0
+    uint8_t valid = data[5] & 0x0F;
+    color.red = (valid & 0x08) ? data[0] : 0;
+    color.green = (valid & 0x04) ? data[1] : 0;
+    color.blue = (valid & 0x02) ? data[2] : 0;
+    color.white = (valid & 0x01) ? data[3] : 0;
+    color.valid = valid;
+  }
+  return color;
+}
+
+size_t DPT::encode_color(const DPTDescriptor &dpt, const Color &color, uint8_t *out) {
+  if (dpt.family == DPTFamily::RGB) {
+    out[0] = color.red;
+    out[1] = color.green;
+    out[2] = color.blue;
+  } else if (dpt.family == DPTFamily::RGBW) {
+    out[0] = color.red;
+    out[1] = color.green;
+    out[2] = color.blue;
+    out[3] = color.white;
+    out[4] = 0x00;
+    out[5] = color.valid & 0x0F;
+  } else {
+    return 0;
+  }
+  return dpt.size();
+}
+
 // Helper functions
 float DPT::clamp(float value, float min, float max) {
   if (value < min) return min;
@@ -1,45 +1,151 @@
 #pragma once
 
+#include <array>
 #include <vector>
 #include <cstdint>
+#include <cstddef>
 #include <string>
 
+// Integer-only receive path for targets without an FPU (e.g. ESP32-C3):
+// entities decode with the *_centi codecs and convert to float once, at publish.
+// Enable with the build flag -DUSE_KNX_FIXED_POINT=1
+#ifndef USE_KNX_FIXED_POINT
+#define USE_KNX_FIXED_POINT 0  // Default: disabled
+#endif
+
 namespace esphome {
 namespace knx_tp {
 
+/**
+ * Encoding families of the generic, descriptor-driven codecs
+ */
+enum class DPTFamily : uint8_t {
+  BOOLEAN,        // 1.xxx - 1 bit
+  UNSIGNED,       // 5.xxx, 7.xxx, 12.xxx, 20.xxx - big-endian unsigned, scaled
+  SIGNED,         // 6.xxx, 8.xxx, 13.xxx - big-endian two's complement, scaled
+  FLOAT16,        // 9.xxx - KNX 2-byte float
+  FLOAT32,        // 14.xxx - IEEE 754 single precision
+  SCENE_NUMBER,   // 17.001 - scene 0-63
+  SCENE_CONTROL,  // 18.001 - bit 7 learn, scene 0-63
+  RGB,            // 232.600 - R, G, B
+  RGBW,           // 251.600 - R, G, B, W, reserved, validity mask
+};
+
+/**
+ * One datapoint type for the generic codecs. The instances are constexpr
+ * (see dpt_registry.h), so only the ones a configuration references end up
+ * in flash
+ */
+struct DPTDescriptor {
+  uint16_t main;
+  uint16_t sub;        // 0 for the main type alone (e.g. "9.xxx")
+  DPTFamily family;
+  uint8_t bits;        // Value size, as in the group object
+  int32_t scale_num;   // UNSIGNED/SIGNED: value = raw * scale_num / scale_den
+  int32_t scale_den;
+  float min;           // encode() clamps to [min, max]
+  float max;
+  const char *unit;
+
+  constexpr size_t size() const { return this->bits < 8 ? 1 : this->bits / 8; }
+};
+
 /**
  * KNX Datapoint Type (DPT) encoding and decoding utilities
  * Implements common DPT formats used in KNX communication
+ *
+ * Every decoder also has a (pointer, length) overload that works directly
+ * on the telegram buffer, used on the receive path to avoid copies.
+ * Every encoder also has a *_fixed variant returning a std::array sized for
+ * the DPT, used on the transmit path so sending never touches the heap.
+ * The *_centi codecs work in fixed-point centi-units (value * 100) with
+ * integer arithmetic only
  */
 class DPT {
  public:
+  // Value sizes in bits, used to size the group object bound to a GA
+  static constexpr uint8_t DPT1_BITS = 1;
+  static constexpr uint8_t DPT3_BITS = 4;
+  static constexpr uint8_t DPT5_BITS = 8;
+  static constexpr uint8_t DPT9_BITS = 16;
+  static constexpr uint8_t DPT10_BITS = 24;
+  static constexpr uint8_t DPT11_BITS = 24;
+  static constexpr uint8_t DPT14_BITS = 32;
+  static constexpr uint8_t DPT16_BITS = 112;
+  static constexpr uint8_t DPT19_BITS = 64;
+  static constexpr uint8_t DPT20_BITS = 8;
+
+  // Encoded sizes in bytes, for the fixed-size encoders
+  static constexpr size_t DPT1_SIZE = 1;
+  static constexpr size_t DPT3_SIZE = 1;
+  static constexpr size_t DPT5_SIZE = 1;
+  static constexpr size_t DPT9_SIZE = 2;
+  static constexpr size_t DPT10_SIZE = 3;
+  static constexpr size_t DPT11_SIZE = 3;
+  static constexpr size_t DPT14_SIZE = 4;
+  static constexpr size_t DPT16_SIZE = 14;
+  static constexpr size_t DPT19_SIZE = 8;
+  static constexpr size_t DPT20_SIZE = 1;
+
+  template<size_t N> using Bytes = std::array<uint8_t, N>;
+
   // DPT 1.xxx - Boolean (1 bit)
   static bool decode_dpt1(const std::vector<uint8_t> &data);
+  static bool decode_dpt1(const uint8_t *data, size_t len);
   static std::vector<uint8_t> encode_dpt1(bool value);
+  static Bytes<DPT1_SIZE> encode_dpt1_fixed(bool value);
+
+  // DPT 3.007 - Control dimming (4 bit): direction + step code
+  // Step code 0 = stop, 1..7 = steps of 100% / 2^(code-1) (1 = ramp the whole range)
+  struct DimmingControl {
+    bool increase;
+    uint8_t step_code;
+  };
+  static DimmingControl decode_dpt3(const uint8_t *data, size_t len);
+  static Bytes<DPT3_SIZE> encode_dpt3_fixed(bool increase, uint8_t step_code);
   
   // DPT 5.xxx - 8-bit unsigned value (0-255)
   static uint8_t decode_dpt5(const std::vector<uint8_t> &data);
+  static uint8_t decode_dpt5(const uint8_t *data, size_t len);
   static std::vector<uint8_t> encode_dpt5(uint8_t value);
+  static Bytes<DPT5_SIZE> encode_dpt5_fixed(uint8_t value);
   
   // DPT 5.001 - Percentage (0-100%)
   static float decode_dpt5_percentage(const std::vector<uint8_t> &data);
+  static float decode_dpt5_percentage(const uint8_t *data, size_t len);
   static std::vector<uint8_t> encode_dpt5_percentage(float value);
+  static Bytes<DPT5_SIZE> encode_dpt5_percentage_fixed(float value);
+  static int32_t decode_dpt5_percentage_centi(const uint8_t *data, size_t len);  // 0-10000
+  static Bytes<DPT5_SIZE> encode_dpt5_percentage_centi_fixed(int32_t centi);
   
   // DPT 5.003 - Angle (0-360°)
   static float decode_dpt5_angle(const std::vector<uint8_t> &data);
+  static float decode_dpt5_angle(const uint8_t *data, size_t len);
   static std::vector<uint8_t> encode_dpt5_angle(float value);
+  static Bytes<DPT5_SIZE> encode_dpt5_angle_fixed(float value);
+  static int32_t decode_dpt5_angle_centi(const uint8_t *data, size_t len);  // 0-36000
+  static Bytes<DPT5_SIZE> encode_dpt5_angle_centi_fixed(int32_t centi);
   
   // DPT 9.xxx - 2-byte float
   static float decode_dpt9(const std::vector<uint8_t> &data);
+  static float decode_dpt9(const uint8_t *data, size_t len);
   static std::vector<uint8_t> encode_dpt9(float value);
+  static Bytes<DPT9_SIZE> encode_dpt9_fixed(float value);
+  static int32_t decode_dpt9_centi(const uint8_t *data, size_t len);  // Exact: M * 2^E
+  static Bytes<DPT9_SIZE> encode_dpt9_centi_fixed(int32_t centi);
   
   // DPT 14.xxx - 4-byte float
   static float decode_dpt14(const std::vector<uint8_t> &data);
+  static float decode_dpt14(const uint8_t *data, size_t len);
   static std::vector<uint8_t> encode_dpt14(float value);
+  static Bytes<DPT14_SIZE> encode_dpt14_fixed(float value);
   
   // DPT 16.001 - Character string (ASCII)
   static std::string decode_dpt16(const std::vector<uint8_t> &data);
+  static std::string decode_dpt16(const uint8_t *data, size_t len);
   static std::vector<uint8_t> encode_dpt16(const std::string &value);
+  // Full 14-byte frame, zero padded (no terminator when all 14 are used)
+  static Bytes<DPT16_SIZE> encode_dpt16_fixed(const std::string &value);
   
   // DPT 20.102 - HVAC Mode
   enum class HVACMode : uint8_t {
@@ -50,7 +156,9 @@ class DPT {
     FROST_PROTECTION = 4
   };
   static HVACMode decode_dpt20_102(const std::vector<uint8_t> &data);
+  static HVACMode decode_dpt20_102(const uint8_t *data, size_t len);
   static std::vector<uint8_t> encode_dpt20_102(HVACMode mode);
+  static Bytes<DPT20_SIZE> encode_dpt20_102_fixed(HVACMode mode);
 
   // DPT 10.001 - Time of Day (3 bytes)
   struct TimeOfDay {
@@ -60,7 +168,9 @@ class DPT {
     uint8_t second;       // 0-59
   };
   static TimeOfDay decode_dpt10(const std::vector<uint8_t> &data);
+  static TimeOfDay decode_dpt10(const uint8_t *data, size_t len);
   static std::vector<uint8_t> encode_dpt10(const TimeOfDay &time);
+  static Bytes<DPT10_SIZE> encode_dpt10_fixed(const TimeOfDay &time);
 
   // DPT 11.001 - Date (3 bytes)
   struct Date {
@@ -69,7 +179,9 @@ class DPT {
     uint16_t year;  // Full year (e.g., 2024)
   };
   static Date decode_dpt11(const std::vector<uint8_t> &data);
+  static Date decode_dpt11(const uint8_t *data, size_t len);
   static std::vector<uint8_t> encode_dpt11(const Date &date);
+  static Bytes<DPT11_SIZE> encode_dpt11_fixed(const Date &date);
 
   // DPT 19.001 - Date and Time (8 bytes)
   // Ottimizzato per minimizzare padding (allineamento memoria)
@@ -93,7 +205,27 @@ class DPT {
     // Totale: 16 bytes (vs ~20 prima con padding)
   };
   static DateTime decode_dpt19(const std::vector<uint8_t> &data);
+  static DateTime decode_dpt19(const uint8_t *data, size_t len);
   static std::vector<uint8_t> encode_dpt19(const DateTime &datetime);
+  static Bytes<DPT19_SIZE> encode_dpt19_fixed(const DateTime &datetime);
+
+  // Generic codecs, one per DPTFamily, driven by a descriptor from dpt_registry.h
+  // decode() returns 0 for the colour families, which use decode_color()
+  static float decode(const DPTDescriptor &dpt, const uint8_t *data, size_t len);
+  static int32_t decode_centi(const DPTDescriptor &dpt, const uint8_t *data, size_t len);  // Saturates to int32
+  // Writes dpt.size() bytes to out and returns that size (0 for the colour families)
+  static size_t encode(const DPTDescriptor &dpt, float value, uint8_t *out);
+
+  // DPT 232.600 / 251.600 - Colour; valid has the 251.600 mask bits (R=8, G=4, B=2, W=1)
+  struct Color {
+    uint8_t red;
+    uint8_t green;
+    uint8_t blue;
+    uint8_t white;
+    uint8_t valid;
+  };
+  static Color decode_color(const DPTDescriptor &dpt, const uint8_t *data, size_t len);
+  static size_t encode_color(const DPTDescriptor &dpt, const Color &color, uint8_t *out);
 
  private:
   // Helper functions
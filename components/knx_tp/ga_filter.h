@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+// Receive pre-filter size in bits, a power of two from 32 to 65536
+// 65536 = one bit per possible group address (8 KB, exact). Smaller sizes hash
+// the GAs onto fewer bits for RAM-tight boards and may let an ignored GA
+// through to the exact lookups: -DKNX_GA_FILTER_BITS=4096 (512 bytes)
+#ifndef KNX_GA_FILTER_BITS
+#define KNX_GA_FILTER_BITS 65536
+#endif
+
+namespace esphome {
+namespace knx_tp {
+
+/**
+ * Set of the group addresses anyone on this device listens to
+ *
+ * Answers "does anyone care about this GA" with a single word load, before
+ * any validation, logging, copying or lookup on the receive path: most bus
+ * traffic is for GAs the device ignores.
+ */
+class GAFilter {
+ public:
+  static constexpr uint32_t BITS = KNX_GA_FILTER_BITS;
+  static_assert(BITS >= 32 && BITS <= 65536 && (BITS & (BITS - 1)) == 0,
+                "KNX_GA_FILTER_BITS must be a power of two from 32 to 65536");
+
+  void add(uint16_t ga) {
+    uint32_t bit = index_(ga);
+    this->words_[bit >> 5] |= 1u << (bit & 31);
+  }
+  // Let every GA through (an on_telegram trigger wants them all)
+  void add_all() { memset(this->words_, 0xFF, sizeof(this->words_)); }
+  bool contains(uint16_t ga) const {
+    uint32_t bit = index_(ga);
+    return (this->words_[bit >> 5] >> (bit & 31)) & 1;
+  }
+  static constexpr size_t size_bytes() { return BITS / 8; }
+
+ protected:
+  static constexpr uint32_t log2_(uint32_t n) { return n <= 1 ? 0 : 1 + log2_(n >> 1); }
+  static constexpr uint32_t index_(uint16_t ga) {
+    // Exact: the GA is the bit. Compact: Fibonacci hash, keeping the top bits of
+    // the 16-bit product so consecutive GAs of a line land on different words
+    return BITS == 65536 ? ga : ((ga * 40503u) & 0xFFFF) >> (16 - log2_(BITS));
+  }
+
+  uint32_t words_[BITS / 32]{};
+};
+
+}  // namespace knx_tp
+}  // namespace esphome
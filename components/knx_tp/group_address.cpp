@@ -7,6 +7,7 @@
 namespace esphome {
 namespace knx_tp {
 
+#if USE_KNX_ADDRESS_PARSER
 void GroupAddress::set_address(const std::string &address) {
   // Parse address format: "main.middle.sub" or "main/middle/sub"
   std::string addr = address;
@@ -48,18 +49,19 @@ void GroupAddress::set_address(const std::string &address) {
   // Encode: AAAAA/BBB/CCCCCCCC -> area (5 bits), line (3 bits), device (8 bits)
   this->address_ = ((main_val & 0x1F) << 11) | ((middle_val & 0x07) << 8) | (sub_val & 0xFF);
 }
+#endif
 
-std::string GroupAddress::get_address() const {
-  int area = (this->address_ >> 11) & 0x1F;
-  int line = (this->address_ >> 8) & 0x07;
-  int device = this->address_ & 0xFF;
+std::string GroupAddress::to_string(uint16_t address) {
+  int area = (address >> 11) & 0x1F;
+  int line = (address >> 8) & 0x07;
+  int device = address & 0xFF;
 
   char addr[16];
   int written = snprintf(addr, sizeof(addr), "%d/%d/%d", area, line, device);
 
   // Check for snprintf error or truncation
   if (written < 0 || written >= static_cast<int>(sizeof(addr))) {
-    ESP_LOGE("GroupAddress", "Address formatting error for %u", this->address_);
+    ESP_LOGE("GroupAddress", "Address formatting error for %u", address);
     return "0/0/0";  // Return default address on error
   }
 
@@ -0,0 +1,111 @@
+#ifdef USE_HOST
+
+#include "host_platform.h"
+#include "esphome/core/log.h"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace esphome {
+namespace knx_tp {
+
+static constexpr const char* TAG = "knx_tp.host";
+
+// readBytesUart() is called once a frame has started: wait this long per byte
+static constexpr int UART_BYTE_TIMEOUT_MS = 10;
+
+void HostTPPlatform::setupUart() {
+  this->fd_ = open(this->uart_path_.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK);
+  if (this->fd_ < 0) {
+    ESP_LOGE(TAG, "Cannot open %s: %s", this->uart_path_.c_str(), strerror(errno));
+    return;
+  }
+
+  // TP-UART line settings: 19200 baud, 8 data bits, even parity, 1 stop bit
+  struct termios tty;
+  if (tcgetattr(this->fd_, &tty) == 0) {
+    cfmakeraw(&tty);
+    cfsetispeed(&tty, B19200);
+    cfsetospeed(&tty, B19200);
+    tty.c_cflag |= PARENB | CLOCAL | CREAD;
+    tty.c_cflag &= ~(PARODD | CSTOPB);
+    tty.c_cc[VMIN] = 0;
+    tty.c_cc[VTIME] = 0;
+    tcsetattr(this->fd_, TCSANOW, &tty);
+  }
+  ESP_LOGCONFIG(TAG, "TP-UART on %s", this->uart_path_.c_str());
+}
+
+void HostTPPlatform::closeUart() {
+  if (this->fd_ >= 0) {
+    close(this->fd_);
+    this->fd_ = -1;
+  }
+}
+
+int HostTPPlatform::uartAvailable() {
+  int available = 0;
+  if (this->fd_ < 0 || ioctl(this->fd_, FIONREAD, &available) < 0) {
+    return 0;
+  }
+  return available;
+}
+
+size_t HostTPPlatform::writeUart(const uint8_t data) { return this->writeUart(&data, 1); }
+
+size_t HostTPPlatform::writeUart(const uint8_t *buffer, size_t size) {
+  if (this->fd_ < 0) {
+    return 0;
+  }
+  size_t written = 0;
+  while (written < size) {
+    ssize_t n = write(this->fd_, buffer + written, size - written);
+    if (n < 0) {
+      if (errno == EAGAIN || errno == EINTR) {
+        struct pollfd pfd = {this->fd_, POLLOUT, 0};
+        poll(&pfd, 1, UART_BYTE_TIMEOUT_MS);
+        continue;
+      }
+      ESP_LOGW(TAG, "UART write failed: %s", strerror(errno));
+      break;
+    }
+    written += n;
+  }
+  return written;
+}
+
+int HostTPPlatform::readUart() {
+  uint8_t data;
+  return this->readBytesUart(&data, 1) == 1 ? data : -1;
+}
+
+size_t HostTPPlatform::readBytesUart(uint8_t *buffer, size_t length) {
+  if (this->fd_ < 0) {
+    return 0;
+  }
+  size_t received = 0;
+  while (received < length) {
+    ssize_t n = read(this->fd_, buffer + received, length - received);
+    if (n > 0) {
+      received += n;
+      continue;
+    }
+    if (n < 0 && errno != EAGAIN && errno != EINTR) {
+      break;
+    }
+    struct pollfd pfd = {this->fd_, POLLIN, 0};
+    if (poll(&pfd, 1, UART_BYTE_TIMEOUT_MS) <= 0) {
+      break;  // Timeout: return what arrived
+    }
+  }
+  return received;
+}
+
+}  // namespace knx_tp
+}  // namespace esphome
+
+#endif  // USE_HOST
@@ -0,0 +1,37 @@
+#pragma once
+
+#ifdef USE_HOST
+
+#include <linux_platform.h>
+#include <string>
+
+namespace esphome {
+namespace knx_tp {
+
+/**
+ * Thelsing platform for the ESPHome host (Linux) build
+ * LinuxPlatform provides memory, timers and sockets; the TP-UART is reached
+ * through a serial device or pty: a USB TP-UART, or a bus simulator exposed
+ * with e.g. `socat -d -d pty,raw,echo=0,link=/tmp/knx-tp ...`
+ */
+class HostTPPlatform : public LinuxPlatform {
+ public:
+  explicit HostTPPlatform(const std::string &uart_path) : uart_path_(uart_path) {}
+
+  void setupUart() override;
+  void closeUart() override;
+  int uartAvailable() override;
+  size_t writeUart(const uint8_t data) override;
+  size_t writeUart(const uint8_t *buffer, size_t size) override;
+  int readUart() override;
+  size_t readBytesUart(uint8_t *buffer, size_t length) override;
+
+ protected:
+  std::string uart_path_;
+  int fd_{-1};
+};
+
+}  // namespace knx_tp
+}  // namespace esphome
+
+#endif  // USE_HOST
@@ -6,6 +6,7 @@
 #include "knx_tp.h"
 #include "esphome/core/log.h"
 #include <algorithm>
+#include <cstring>
 
 // Include time component header only if time broadcast is used
 #ifdef USE_TIME
@@ -13,25 +14,37 @@
 #endif
 
 // Thelsing KNX stack includes
+#ifdef USE_HOST
+#include "host_platform.h"
+#else
 #include <esp32_idf_platform.h>
+#endif
 #include <knx/bau07B0.h>
 #include <knx/group_object_table_object.h>
 #include <knx/group_object.h>
+#include <knx/table_object.h>
+#include <knx/property.h>
+#include <knx/memory.h>
 
 namespace esphome {
 namespace knx_tp {
 
 static constexpr const char* TAG = "knx_tp";
 
+// Longest wait for the bus confirmation (L_Data.con) of a frame, repetitions included
+static constexpr uint32_t TX_CONFIRM_TIMEOUT_MS = 1000;
+
 void KNXTPComponent::setup() {
   ESP_LOGCONFIG(TAG, "Setting up KNX TP with Thelsing stack...");
-  ESP_LOGCONFIG(TAG, "Physical Address: %s", this->physical_address_.c_str());
+  ESP_LOGCONFIG(TAG, "Physical Address: %s", this->get_physical_address().c_str());
 
+#ifndef USE_HOST
   if (!this->parent_) {
     ESP_LOGE(TAG, "UART parent not set!");
     this->mark_failed();
     return;
   }
+#endif
 
   // Setup SAV pin if configured
   if (this->sav_pin_ != nullptr) {
@@ -40,33 +53,26 @@ void KNXTPComponent::setup() {
     ESP_LOGCONFIG(TAG, "SAV pin configured for BCU detection");
   }
 
+#ifdef USE_HOST
+  // Host build: Linux platform, TP-UART behind a serial device or pty
+  this->platform_ = new HostTPPlatform(this->host_uart_path_);
+#else
   // Create ESP32-IDF KNX platform (from Thelsing library)
   // UART_NUM_1 is the default UART port for KNX
   this->platform_ = new Esp32IdfPlatform(UART_NUM_1);
+#endif
 
   // Create BAU (Bus Access Unit) - 07B0 is for TP with BCU1
   this->bau_ = new Bau07B0(*this->platform_);
 
-  // Convert physical address
-  this->physical_address_int_ = this->address_to_int_(this->physical_address_);
-
   // Set device address
   this->bau_->deviceObject().individualAddress(this->physical_address_int_);
 
-  // Configure group objects for each registered group address
-  auto& groupObjectTable = this->bau_->groupObjectTable();
-  uint16_t go_index = 1;  // Group object indices start at 1
-
-  for (auto *ga : this->group_addresses_) {
-    uint16_t ga_int = this->address_to_int_(ga->get_address());
-
-    // Create group object
-    // This simplified version creates basic group objects
-    // In a full implementation, you'd configure DPT types, flags, etc.
-    ESP_LOGD(TAG, "Configuring group object %u for GA %s (%u)",
-             go_index, ga->get_address().c_str(), ga_int);
-
-    go_index++;
+  // Bind a group object to every GA in use, so the stack drops all other traffic
+  if (!this->configure_group_objects_()) {
+    ESP_LOGE(TAG, "Failed to load group object tables");
+    this->mark_failed();
+    return;
   }
 
   // Enable the KNX device
@@ -119,11 +125,12 @@ void KNXTPComponent::loop() {
   // Process KNX stack only if BCU is connected
   if (this->bau_ && this->bcu_connected_) {
     this->bau_->loop();
+    this->process_tx_queue_();
   }
 
   // Time broadcast (only if BCU is connected)
 #ifdef USE_TIME
-  if (this->bcu_connected_ && this->time_source_ != nullptr && !this->time_broadcast_ga_id_.empty()) {
+  if (this->bcu_connected_ && this->time_source_ != nullptr && this->time_broadcast_ga_ != nullptr) {
     uint32_t now = millis();
     if (now - this->last_time_broadcast_ >= this->time_broadcast_interval_) {
       this->broadcast_time_();
@@ -132,23 +139,56 @@ void KNXTPComponent::loop() {
   }
 #endif
 
-  // The Esp32IdfPlatform handles UART internally, no explicit loop needed
+  // The platform handles UART internally, no explicit loop needed
   // Check for incoming telegrams - handled internally via callbacks
+
+  // Publish coalescing: one delivery per listener for everything received this loop
+  this->flush_pending_values_();
 }
 
 void KNXTPComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "KNX TP (Thelsing Stack):");
   ESP_LOGCONFIG(TAG, "  Physical Address: %s (0x%04X)",
-                this->physical_address_.c_str(), this->physical_address_int_);
-  ESP_LOGCONFIG(TAG, "  Group Addresses: %d", this->group_addresses_.size());
+                this->get_physical_address().c_str(), this->physical_address_int_);
+  ESP_LOGCONFIG(TAG, "  Group Addresses: %u", static_cast<unsigned>(this->group_addresses_.size()));
 
   for (const auto *ga : this->group_addresses_) {
-    uint16_t ga_int = this->address_to_int_(ga->get_address());
-    ESP_LOGCONFIG(TAG, "    %s: %s (0x%04X)",
-                  ga->get_id().c_str(), ga->get_address().c_str(), ga_int);
+    // Group object flags in ETS order, '-' when unset
+    const GroupObjectEntry *object = this->find_group_object_(ga->get_address_int());
+    uint8_t flags = object != nullptr ? object->flags : 0;
+    char flag_str[7] = {
+        (flags & GO_FLAG_COMMUNICATION) ? 'C' : '-', (flags & GO_FLAG_READ) ? 'R' : '-',
+        (flags & GO_FLAG_WRITE) ? 'W' : '-',         (flags & GO_FLAG_TRANSMIT) ? 'T' : '-',
+        (flags & GO_FLAG_UPDATE) ? 'U' : '-',        (flags & GO_FLAG_READ_ON_INIT) ? 'I' : '-', '\0'};
+    ESP_LOGCONFIG(TAG, "    %s: %s (0x%04X) %s, %u bits",
+                  ga->get_id(), ga->get_address().c_str(), ga->get_address_int(), flag_str,
+                  object != nullptr ? object->value_bits : 0);
+  }
+  ESP_LOGCONFIG(TAG, "  Group Objects: %u", static_cast<unsigned>(this->group_object_count_));
+  ESP_LOGCONFIG(TAG, "  RX Filter: %u bytes%s", static_cast<unsigned>(GAFilter::size_bytes()),
+                GAFilter::BITS == 65536 ? "" : " (compact)");
+  if (this->coalesce_publish_) {
+    ESP_LOGCONFIG(TAG, "  Publish Coalescing: enabled");
   }
 
-  ESP_LOGCONFIG(TAG, "  Registered Entities: %d", this->entities_.size());
+  ESP_LOGCONFIG(TAG, "  TX Queue: %u frames, interval %u ms", static_cast<unsigned>(TxQueue::capacity()),
+                this->tx_interval_);
+  if (this->send_dedup_window_ > 0) {
+    ESP_LOGCONFIG(TAG, "  Send Dedup Window: %u ms", this->send_dedup_window_);
+  }
+  ESP_LOGCONFIG(TAG, "  Registered Entities: %u", static_cast<unsigned>(this->entities_.size()));
+  if (!this->telegram_entities_.empty()) {
+    // They need every telegram, so the RX filter lets everything through
+    ESP_LOGCONFIG(TAG, "    Legacy (on_knx_telegram): %u", static_cast<unsigned>(this->telegram_entities_.size()));
+  }
+  if (this->listener_table_stale_) {
+    this->build_listener_table_();
+  }
+  size_t listened = 0;
+  for (size_t i = 0; i < this->group_object_count_; i++) {
+    listened += this->go_listener_start_[i] != this->go_listener_start_[i + 1];
+  }
+  ESP_LOGCONFIG(TAG, "  Listened Group Addresses: %u", static_cast<unsigned>(listened));
 
   if (this->bau_) {
     ESP_LOGCONFIG(TAG, "  BAU Status: %s", this->bau_->enabled() ? "Enabled" : "Disabled");
@@ -162,47 +202,232 @@ void KNXTPComponent::dump_config() {
 
   // Time broadcast info
 #ifdef USE_TIME
-  if (this->time_source_ != nullptr && !this->time_broadcast_ga_id_.empty()) {
+  if (this->time_source_ != nullptr && this->time_broadcast_ga_ != nullptr) {
     ESP_LOGCONFIG(TAG, "  Time Broadcast:");
-    ESP_LOGCONFIG(TAG, "    GA: %s", this->time_broadcast_ga_id_.c_str());
+    ESP_LOGCONFIG(TAG, "    GA: %s (%s)", this->time_broadcast_ga_->get_id(),
+                  this->time_broadcast_ga_->get_address().c_str());
     ESP_LOGCONFIG(TAG, "    Interval: %u seconds", this->time_broadcast_interval_ / 1000);
   }
 #endif
 }
 
+#if USE_KNX_ADDRESS_PARSER
 void KNXTPComponent::set_physical_address(const std::string &address) {
-  this->physical_address_ = address;
-  this->physical_address_int_ = this->address_to_int_(address);
+  this->physical_address_int_ = this->parse_physical_address_(address);
   ESP_LOGD(TAG, "Physical address set to: %s (0x%04X)", address.c_str(), this->physical_address_int_);
 }
+#endif
+
+std::string KNXTPComponent::get_physical_address() const {
+  // Individual address: AAAA.LLLL.DDDDDDDD (area 4 bits, line 4 bits, device 8 bits)
+  char addr[16];
+  snprintf(addr, sizeof(addr), "%u.%u.%u", (this->physical_address_int_ >> 12) & 0x0F,
+           (this->physical_address_int_ >> 8) & 0x0F, this->physical_address_int_ & 0xFF);
+  return std::string(addr);
+}
 
 void KNXTPComponent::set_uart_parent(uart::UARTComponent *parent) {
   this->parent_ = parent;
 }
 
+static bool ga_id_less(const GroupAddress *a, const GroupAddress *b) { return strcmp(a->get_id(), b->get_id()) < 0; }
+
 void KNXTPComponent::register_group_address(GroupAddress *ga) {
-  this->group_addresses_.push_back(ga);
-  // Add to hash map for O(1) lookup
-  this->ga_lookup_[ga->get_id()] = ga;
-  ESP_LOGD(TAG, "Registered group address: %s -> %s", ga->get_id().c_str(), ga->get_address().c_str());
+  // Codegen registers in id order, so this appends; keep the vector sorted for
+  // get_group_address() either way
+  auto pos = this->group_addresses_.end();
+  if (!this->group_addresses_.empty() && ga_id_less(ga, this->group_addresses_.back())) {
+    pos = std::upper_bound(this->group_addresses_.begin(), this->group_addresses_.end(), ga, ga_id_less);
+  }
+  this->group_addresses_.insert(pos, ga);
+  ESP_LOGD(TAG, "Registered group address: %s -> %s", ga->get_id(), ga->get_address().c_str());
 }
 
 void KNXTPComponent::register_entity(KNXEntity *entity) {
   this->entities_.push_back(entity);
   entity->set_knx_component(this);
-  ESP_LOGD(TAG, "Registered entity (total: %d)", this->entities_.size());
+  if (!entity->uses_listeners()) {
+    // Written against on_knx_telegram(): it expects every telegram
+    this->telegram_entities_.push_back(entity);
+    this->rx_filter_.add_all();
+  }
+  ESP_LOGD(TAG, "Registered entity (total: %u)", static_cast<unsigned>(this->entities_.size()));
+}
+
+void KNXTPComponent::register_listener(GroupAddress *ga, KNXEntity *entity, uint8_t role) {
+  if (ga == nullptr) {
+    ESP_LOGW(TAG, "Cannot register listener: no group address");
+    return;
+  }
+  // Growing listeners_ moves the entries dirty_listeners_ points to
+  this->flush_pending_values_();
+  this->listeners_.push_back({entity, ga->get_address_int(), role, false, 0, {}});
+  this->listener_table_stale_ = true;
+  this->rx_filter_.add(ga->get_address_int());
+  ESP_LOGD(TAG, "Registered listener on %s (%s), role %u", ga->get_id(), ga->get_address().c_str(), role);
+}
+
+void KNXTPComponent::register_listener(const std::string &ga_id, KNXEntity *entity, uint8_t role) {
+  auto *ga = this->get_group_address(ga_id);
+  if (ga == nullptr) {
+    ESP_LOGW(TAG, "Cannot register listener: Group address %s not found", ga_id.c_str());
+    return;
+  }
+  this->register_listener(ga, entity, role);
+}
+
+// KNX group object value type code for a value size in bits (descriptor bits 0-5)
+static uint8_t go_type_code(uint8_t bits) {
+  if (bits < 8) {
+    return bits - 1;  // 1..7 bit values: codes 0..6
+  }
+  switch (bits / 8) {
+    case 1: return 7;
+    case 2: return 8;
+    case 3: return 9;
+    case 4: return 10;
+    case 6: return 11;
+    case 8: return 12;
+    case 10: return 13;
+    default: return 14;  // 14 bytes (DPT 16)
+  }
+}
+
+// Stack priority code for a queue priority class (descriptor bits 7-6)
+static uint8_t stack_priority(KNXPriority priority) {
+  switch (priority) {
+    case KNX_PRIORITY_SYSTEM: return SystemPriority;
+    case KNX_PRIORITY_URGENT: return UrgentPriority;
+    case KNX_PRIORITY_NORMAL: return NormalPriority;
+    default: return LowPriority;
+  }
+}
+
+// Load a table object the way ETS does: start loading, allocate the table's
+// data segment, write the image into it, then mark it loaded. data, when
+// given, receives where the table lives in the stack's memory
+static bool load_table_object(Bau07B0 *bau, ObjectType type, std::vector<uint8_t> &image,
+                              uint8_t **data = nullptr) {
+  auto *table = static_cast<TableObject *>(bau->getInterfaceObject(type, 0));
+  if (table == nullptr) {
+    return false;
+  }
+
+  uint8_t count = 1;
+  uint8_t start[10] = {LE_START_LOADING};
+  table->writeProperty(PID_LOAD_STATE_CONTROL, 1, start, count);
+
+  // Additional load control 0x0B: allocate a zero-filled segment of image.size() bytes
+  uint32_t size = image.size();
+  uint8_t alloc[10] = {LE_ADDITIONAL_LOAD_CONTROLS, 0x0B,
+                       static_cast<uint8_t>(size >> 24), static_cast<uint8_t>(size >> 16),
+                       static_cast<uint8_t>(size >> 8), static_cast<uint8_t>(size),
+                       0x01, 0x00};
+  count = 1;
+  table->writeProperty(PID_LOAD_STATE_CONTROL, 1, alloc, count);
+
+  // Copy the image to where the table now lives
+  uint8_t ref[4] = {0};
+  count = 1;
+  table->readProperty(PID_TABLE_REFERENCE, 1, count, ref);
+  if (count == 0) {
+    return false;
+  }
+  uint32_t rel_addr = (ref[0] << 24) | (ref[1] << 16) | (ref[2] << 8) | ref[3];
+  bau->memory().writeMemory(rel_addr, image.size(), image.data());
+  if (data != nullptr) {
+    *data = bau->memory().toAbsolute(rel_addr);
+  }
+
+  count = 1;
+  uint8_t completed[10] = {LE_LOAD_COMPLETED};
+  table->writeProperty(PID_LOAD_STATE_CONTROL, 1, completed, count);
+
+  return table->loadState() == LS_LOADED;
+}
+
+bool KNXTPComponent::configure_group_objects_() {
+  // One group object per GA, straight from the codegen table: already sorted
+  // by address (as ETS sorts the address table), merged, flagged and sized
+  const GroupObjectEntry *objects = this->group_objects_;
+
+  // Table images: address table = count + GAs (tsap 1..N), association table =
+  // count + (tsap, asap) pairs, group object table = count + descriptors
+  size_t n = this->group_object_count_;
+  std::vector<uint8_t> addr_table, assoc_table, go_table;
+  addr_table.reserve(2 + 2 * n);
+  assoc_table.reserve(2 + 4 * n);
+  go_table.reserve(2 + 2 * n);
+  auto put16 = [](std::vector<uint8_t> &image, uint16_t value) {
+    image.push_back(value >> 8);
+    image.push_back(value & 0xFF);
+  };
+  put16(addr_table, n);
+  put16(assoc_table, n);
+  put16(go_table, n);
+
+  for (size_t i = 0; i < n; i++) {
+    const auto &object = objects[i];
+    uint16_t index = i + 1;  // tsap == asap
+    put16(addr_table, object.ga);
+    put16(assoc_table, index);
+    put16(assoc_table, index);
+
+    // Descriptor: U T I W R C flags (bits 15-10), priority (bits 7-6, set per frame), value type (bits 5-0)
+    uint16_t descriptor = go_type_code(object.value_bits) | (LowPriority << 6);
+    if (object.flags & GO_FLAG_COMMUNICATION) descriptor |= 1 << 10;
+    if (object.flags & GO_FLAG_READ) descriptor |= 1 << 11;
+    if (object.flags & GO_FLAG_WRITE) descriptor |= 1 << 12;
+    if (object.flags & GO_FLAG_READ_ON_INIT) descriptor |= 1 << 13;
+    if (object.flags & GO_FLAG_TRANSMIT) descriptor |= 1 << 14;
+    if (object.flags & GO_FLAG_UPDATE) descriptor |= 1 << 15;
+    put16(go_table, descriptor);
+  }
+
+  // No application program parameters, but the stack only runs once it is loaded
+  std::vector<uint8_t> app_program = {0};
+  if (!load_table_object(this->bau_, OT_ADDR_TABLE, addr_table) ||
+      !load_table_object(this->bau_, OT_ASSOC_TABLE, assoc_table) ||
+      !load_table_object(this->bau_, OT_GRP_OBJ_TABLE, go_table, &this->go_table_) ||
+      !load_table_object(this->bau_, OT_APPLICATION_PROG, app_program)) {
+    return false;
+  }
+
+#if USE_KNX_ON_GROUP_ADDRESS
+  this->build_callback_table_();
+#endif
+
+  // Send deduplication: last written value per group object
+  if (this->send_dedup_window_ > 0) {
+    this->sent_values_.assign(n, SentValue{0, SentValue::NONE, {}});
+  }
+
+  // Route group object updates to the dispatch index
+  auto &table = this->bau_->groupObjectTable();
+  for (size_t i = 0; i < n; i++) {
+    table.get(i + 1).callback([this, i](GroupObject &go) {
+      this->group_object_callback_(i, go.valueRef(), go.valueSize());
+    });
+    ESP_LOGD(TAG, "Group object %u -> GA %s (%u bits, flags 0x%02X)", static_cast<unsigned>(i + 1),
+             GroupAddress::to_string(objects[i].ga).c_str(), objects[i].value_bits, objects[i].flags);
+  }
+
+  ESP_LOGCONFIG(TAG, "Configured %u group objects", static_cast<unsigned>(n));
+  return true;
 }
 
 GroupAddress *KNXTPComponent::get_group_address(const std::string &id) {
-  // O(1) hash map lookup instead of O(n) linear search
-  auto it = this->ga_lookup_.find(id);
-  if (it != this->ga_lookup_.end()) {
-    return it->second;
+  // group_addresses_ is sorted by id: binary search, no hashing or extra index
+  auto it = std::lower_bound(this->group_addresses_.begin(), this->group_addresses_.end(), id,
+                             [](const GroupAddress *ga, const std::string &key) { return key.compare(ga->get_id()) > 0; });
+  if (it != this->group_addresses_.end() && id.compare((*it)->get_id()) == 0) {
+    return *it;
   }
   ESP_LOGW(TAG, "Group address '%s' not found", id.c_str());
   return nullptr;
 }
 
+#if USE_KNX_ADDRESS_PARSER
 void KNXTPComponent::send_telegram(const std::string &dest_addr, const std::vector<uint8_t> &data) {
   if (!this->bau_) {
     ESP_LOGW(TAG, "BAU not initialized, cannot send telegram");
@@ -211,112 +436,321 @@ void KNXTPComponent::send_telegram(const std::string &dest_addr, const std::vect
 
   uint16_t dest_addr_int = this->address_to_int_(dest_addr);
 
-  ESP_LOGD(TAG, "Sending telegram to %s (0x%04X) with %d bytes",
-           dest_addr.c_str(), dest_addr_int, data.size());
+  ESP_LOGD(TAG, "Sending telegram to %s (0x%04X) with %u bytes",
+           dest_addr.c_str(), dest_addr_int, static_cast<unsigned>(data.size()));
 
-  // Find the group object for this address
-  auto& groupObjectTable = this->bau_->groupObjectTable();
-
-  // For simplicity, we'll use the lower-level telegram interface
-  // In a full implementation, you'd map to specific group objects
-
-  if (data.size() > 0) {
-    // Usa buffer statico invece di std::string per evitare allocazioni
-    // Max 32 bytes di dati = 96 caratteri (3 per byte) + null terminator
-    char data_hex[97];
-    size_t offset = 0;
-    for (size_t i = 0; i < data.size() && i < 32; i++) {
-      size_t remaining = sizeof(data_hex) - offset;
-      int written = snprintf(data_hex + offset, remaining, "%02X ", data[i]);
-
-      // Check for snprintf error (negative return value)
-      if (written < 0) {
-        ESP_LOGE(TAG, "snprintf error in data hex formatting");
-        break;
-      }
-
-      // Check if buffer would overflow (snprintf returns chars that would be written)
-      if (static_cast<size_t>(written) >= remaining) {
-        // Buffer full, truncation would occur, stop
-        break;
-      }
-
-      offset += written;
-    }
-    // Ensure null termination (defensive programming)
-    if (offset < sizeof(data_hex)) {
-      data_hex[offset] = '\0';
-    } else {
-      data_hex[sizeof(data_hex) - 1] = '\0';
-    }
-    ESP_LOGV(TAG, "  Data: %s", data_hex);
-  }
+  this->queue_frame_(dest_addr_int, KNXService::WRITE, data.data(), data.size(), KNX_PRIORITY_LOW, nullptr);
 }
+#endif
 
-void KNXTPComponent::send_group_write(const std::string &ga_id, const std::vector<uint8_t> &data) {
+void KNXTPComponent::send_group_write(const std::string &ga_id, const uint8_t *data, size_t len,
+                                      KNXPriority priority, KNXTxCallback &&on_complete) {
   auto ga = this->get_group_address(ga_id);
   if (ga != nullptr) {
     ESP_LOGD(TAG, "Group write to %s (%s)", ga_id.c_str(), ga->get_address().c_str());
-    this->send_telegram(ga->get_address(), data);
+    this->send_group_write(ga->get_address_int(), data, len, priority, std::move(on_complete));
   } else {
     ESP_LOGW(TAG, "Cannot send group write: Group address %s not found", ga_id.c_str());
   }
 }
 
-void KNXTPComponent::send_group_read(const std::string &ga_id) {
+void KNXTPComponent::send_group_read(const std::string &ga_id, KNXPriority priority, KNXTxCallback &&on_complete) {
   auto ga = this->get_group_address(ga_id);
   if (ga != nullptr) {
     ESP_LOGD(TAG, "Group read request to %s (%s)", ga_id.c_str(), ga->get_address().c_str());
-    std::vector<uint8_t> empty_data;
-    this->send_telegram(ga->get_address(), empty_data);
+    this->send_group_read(ga->get_address_int(), priority, std::move(on_complete));
   } else {
     ESP_LOGW(TAG, "Cannot send group read: Group address %s not found", ga_id.c_str());
   }
 }
 
-void KNXTPComponent::send_group_response(const std::string &ga_id, const std::vector<uint8_t> &data) {
+void KNXTPComponent::send_group_response(const std::string &ga_id, const uint8_t *data, size_t len,
+                                         KNXPriority priority, KNXTxCallback &&on_complete) {
   auto ga = this->get_group_address(ga_id);
   if (ga != nullptr) {
     ESP_LOGD(TAG, "Group response to %s (%s)", ga_id.c_str(), ga->get_address().c_str());
-    this->send_telegram(ga->get_address(), data);
+    this->send_group_response(ga->get_address_int(), data, len, priority, std::move(on_complete));
   } else {
     ESP_LOGW(TAG, "Cannot send group response: Group address %s not found", ga_id.c_str());
   }
 }
 
+void KNXTPComponent::queue_frame_(uint16_t ga, KNXService service, const uint8_t *data, size_t len,
+                                  KNXPriority priority, KNXTxCallback &&on_complete) {
+  // Send deduplication: the bus already carries this value, don't spend a frame on it
+  SentValue *sent = nullptr;
+  if (service == KNXService::WRITE && !this->sent_values_.empty()) {
+    uint16_t asap = this->find_asap_(ga);
+    if (asap != 0) {
+      uint32_t now = millis();
+      if (this->is_duplicate_write_(asap - 1, data, len, now)) {
+        ESP_LOGV(TAG, "Skipping duplicate write to GA %u/%u/%u", (ga >> 11) & 0x1F, (ga >> 8) & 0x07, ga & 0xFF);
+        if (on_complete) {
+          on_complete(true);
+        }
+        return;
+      }
+      sent = &this->sent_values_[asap - 1];
+      sent->time = now;
+    }
+  }
+
+  KNXFrame *frame = this->tx_queue_.push(ga, service, priority, data, len);
+  if (frame == nullptr) {
+    // Queue full (or oversized payload): fail now rather than block or drop silently
+    ESP_LOGW(TAG, "TX queue full, dropping frame for GA %u/%u/%u (%u bytes)", (ga >> 11) & 0x1F, (ga >> 8) & 0x07,
+             ga & 0xFF, static_cast<unsigned>(len));
+    if (on_complete) {
+      on_complete(false);
+    }
+    return;
+  }
+  if (sent != nullptr) {
+    sent->len = frame->len;
+    memcpy(sent->data, frame->data, frame->len);
+  }
+  frame->on_complete = std::move(on_complete);
+  ESP_LOGV(TAG, "Queued frame for GA %u/%u/%u, priority %u (%u waiting)", (ga >> 11) & 0x1F, (ga >> 8) & 0x07,
+           ga & 0xFF, priority, static_cast<unsigned>(this->tx_queue_.size()));
+}
+
+bool KNXTPComponent::is_duplicate_write_(size_t object, const uint8_t *data, size_t len, uint32_t now) const {
+  const SentValue &sent = this->sent_values_[object];
+  return sent.len == len && now - sent.time < this->send_dedup_window_ && memcmp(sent.data, data, len) == 0;
+}
+
+void KNXTPComponent::process_tx_queue_() {
+  uint32_t now = millis();
+
+  // Wait for the confirmation of the frame on the bus
+  if (this->tx_in_flight_ != nullptr) {
+    auto &go = this->bau_->groupObjectTable().get(this->find_asap_(this->tx_in_flight_->ga));
+    switch (go.commFlag()) {
+      case Ok:
+      case Updated:  // Read answered already
+        this->complete_frame_(true);
+        break;
+      case Error:
+        this->complete_frame_(false);
+        break;
+      default:
+        if (now - this->tx_last_ >= TX_CONFIRM_TIMEOUT_MS) {
+          ESP_LOGW(TAG, "No bus confirmation for GA %u/%u/%u", (this->tx_in_flight_->ga >> 11) & 0x1F,
+                   (this->tx_in_flight_->ga >> 8) & 0x07, this->tx_in_flight_->ga & 0xFF);
+          this->complete_frame_(false);
+        }
+        return;
+    }
+  }
+
+  // Pace frames to what the bus can carry, highest priority first
+  while (!this->tx_queue_.empty() && now - this->tx_last_ >= this->tx_interval_) {
+    KNXFrame *frame = this->tx_queue_.pop();
+    this->tx_in_flight_ = frame;
+    if (this->start_frame_(frame)) {
+      this->tx_last_ = now;
+      return;
+    }
+    this->complete_frame_(false);  // Could not be handed to the stack, try the next one
+  }
+}
+
+bool KNXTPComponent::start_frame_(KNXFrame *frame) {
+  uint16_t asap = this->find_asap_(frame->ga);
+  if (asap == 0) {
+    ESP_LOGW(TAG, "GA %u/%u/%u has no group object, cannot send", (frame->ga >> 11) & 0x1F,
+             (frame->ga >> 8) & 0x07, frame->ga & 0xFF);
+    return false;
+  }
+
+  // The stack takes the telegram priority from the group object descriptor
+  // (big endian, after the 2 byte count), so give it the frame's class
+  if (this->go_table_ != nullptr) {
+    uint8_t &descriptor_low = this->go_table_[asap * 2 + 1];
+    descriptor_low = (descriptor_low & 0x3F) | (stack_priority(frame->priority) << 6);
+  }
+
+  auto &go = this->bau_->groupObjectTable().get(asap);
+  if (frame->service == KNXService::READ) {
+    go.requestObjectRead();
+    return true;
+  }
+
+  // Values shorter than the group object are zero padded (e.g. DPT 16 strings)
+  size_t size = go.valueSize();
+  if (frame->len > size) {
+    ESP_LOGW(TAG, "%u byte value does not fit the %u byte group object of GA %u/%u/%u",
+             frame->len, static_cast<unsigned>(size), (frame->ga >> 11) & 0x1F, (frame->ga >> 8) & 0x07,
+             frame->ga & 0xFF);
+    return false;
+  }
+  memcpy(go.valueRef(), frame->data, frame->len);
+  memset(go.valueRef() + frame->len, 0, size - frame->len);
+
+  if (frame->service == KNXService::RESPONSE) {
+    // The stack answers GroupValue_Read itself from the group object value
+    // (R flag), so a response only updates that value: nothing to confirm
+    if (!(this->group_objects_[asap - 1].flags & GO_FLAG_READ)) {
+      ESP_LOGW(TAG, "GA %u/%u/%u has no read flag: the stack will not answer reads with this value",
+               (frame->ga >> 11) & 0x1F, (frame->ga >> 8) & 0x07, frame->ga & 0xFF);
+    }
+    go.commFlag(Ok);
+  } else {
+    go.objectWritten();
+  }
+  return true;
+}
+
+void KNXTPComponent::complete_frame_(bool success) {
+  KNXFrame *frame = this->tx_in_flight_;
+  this->tx_in_flight_ = nullptr;
+  if (!success && frame->service == KNXService::WRITE && !this->sent_values_.empty()) {
+    // Not on the bus after all: the next write of this value must go out
+    uint16_t asap = this->find_asap_(frame->ga);
+    if (asap != 0) {
+      this->sent_values_[asap - 1].len = SentValue::NONE;
+    }
+  }
+  // Free the slot first: the callback may well queue the next frame
+  KNXTxCallback on_complete = std::move(frame->on_complete);
+  this->tx_queue_.release(frame);
+  if (on_complete) {
+    on_complete(success);
+  }
+}
+
+const GroupObjectEntry *KNXTPComponent::find_group_object_(uint16_t ga) const {
+  // The group object table is sorted by address: binary search
+  const GroupObjectEntry *end = this->group_objects_ + this->group_object_count_;
+  const GroupObjectEntry *it = std::lower_bound(
+      this->group_objects_, end, ga, [](const GroupObjectEntry &object, uint16_t key) { return object.ga < key; });
+  return it != end && it->ga == ga ? it : nullptr;
+}
+
+uint16_t KNXTPComponent::find_asap_(uint16_t ga) const {
+  // asap = table index + 1 (0 = not found)
+  const GroupObjectEntry *object = this->find_group_object_(ga);
+  return object != nullptr ? (object - this->group_objects_) + 1 : 0;
+}
+
 void KNXTPComponent::parse_telegram_(const std::vector<uint8_t> &telegram) {
   // With Thelsing stack, telegram parsing is handled internally
   // This function is kept for compatibility but may not be needed
-  ESP_LOGV(TAG, "parse_telegram_ called with %d bytes", telegram.size());
+  ESP_LOGV(TAG, "parse_telegram_ called with %u bytes", static_cast<unsigned>(telegram.size()));
 }
 
-void KNXTPComponent::notify_entities_(const std::string &ga, uint16_t ga_int, const std::vector<uint8_t> &data) {
-  ESP_LOGV(TAG, "Notifying %d entities about telegram for GA %s", this->entities_.size(), ga.c_str());
+void KNXTPComponent::notify_entities_(size_t object, uint16_t ga, const uint8_t *data, uint8_t len) {
+  ESP_LOGV(TAG, "Dispatching telegram for GA %u/%u/%u", (ga >> 11) & 0x1F, (ga >> 8) & 0x07, ga & 0xFF);
 
 #if USE_KNX_ON_TELEGRAM
   // Call generic telegram triggers (for ALL telegrams)
-  // Note: Pass copies to avoid lifetime issues with lambdas
-  this->telegram_callbacks_.call(ga, data);
+  // Their string/vector arguments are only built when a trigger is configured
+  if (this->has_telegram_callbacks_) {
+    this->telegram_callbacks_.call(GroupAddress::to_string(ga), std::vector<uint8_t>(data, data + len));
+  }
 #endif
 
 #if USE_KNX_ON_GROUP_ADDRESS
-  // Call group address specific triggers (O(1) lookup)
-  // Use pre-converted integer address to avoid redundant conversion
-  auto it = this->ga_callbacks_.find(ga_int);
-  if (it != this->ga_callbacks_.end()) {
-    it->second.call(data);
+  // Call group address specific triggers: one indexed slice of the flat table
+  uint16_t first = this->go_callback_start_[object];
+  uint16_t last = this->go_callback_start_[object + 1];
+  if (first != last) {
+    this->callback_data_.assign(data, data + len);  // Keeps its capacity: no allocation once grown
+    for (uint16_t k = first; k < last; k++) {
+      this->ga_callbacks_[this->go_callbacks_[k]].callback(this->callback_data_);
+    }
   }
 #endif
 
-  // Notify registered entities
-  for (auto *entity : this->entities_) {
-    if (entity != nullptr) {
-      entity->on_knx_telegram(ga, data);
+  // Legacy entities get everything, with the string/vector arguments they expect
+  if (!this->telegram_entities_.empty()) {
+    std::string ga_str = GroupAddress::to_string(ga);
+    std::vector<uint8_t> payload(data, data + len);
+    for (auto *entity : this->telegram_entities_) {
+      entity->on_knx_telegram(ga_str, payload);
+    }
+  }
+
+  // Notify only the entities listening on this group object: one indexed slice of the flat table
+  if (this->listener_table_stale_) {
+    this->build_listener_table_();
+  }
+  uint16_t first_listener = this->go_listener_start_[object];
+  uint16_t last_listener = this->go_listener_start_[object + 1];
+  for (uint16_t k = first_listener; k < last_listener; k++) {
+    KNXListener &listener = this->listeners_[this->go_listeners_[k]];
+    if (this->coalesce_publish_ && len <= KNX_COALESCE_MAX_PAYLOAD) {
+      // Park the value: the entity publishes once, at the end of loop(), with the latest one
+      if (!listener.dirty) {
+        listener.dirty = true;
+        this->dirty_listeners_.emplace_back(ga, &listener);
+      }
+      memcpy(listener.pending, data, len);
+      listener.pending_len = len;
+      continue;
+    }
+    // Delivered now: a value parked earlier this loop is older, drop it
+    listener.dirty = false;
+    listener.entity->on_knx_group_value(listener.role, ga, data, len);
+  }
+}
+
+void KNXTPComponent::build_listener_table_() {
+  // Bucket the listeners by group object once (the stack delivers no other GA):
+  // group object i gets a contiguous slice of listener indices, in registration order
+  size_t n = this->group_object_count_;
+  this->go_listener_start_.assign(n + 1, 0);
+  std::vector<uint16_t> objects;
+  objects.reserve(this->listeners_.size());
+  for (const auto &listener : this->listeners_) {
+    const GroupObjectEntry *object = this->find_group_object_(listener.ga);
+    if (object == nullptr) {
+      ESP_LOGW(TAG, "No group object for listened GA %s, it is never received",
+               GroupAddress::to_string(listener.ga).c_str());
+      objects.push_back(n);
+      continue;
     }
+    objects.push_back(object - this->group_objects_);
+    this->go_listener_start_[objects.back() + 1]++;
+  }
+  for (size_t i = 0; i < n; i++) {
+    this->go_listener_start_[i + 1] += this->go_listener_start_[i];
   }
+  this->go_listeners_.resize(this->go_listener_start_[n]);
+  std::vector<uint16_t> next(this->go_listener_start_.begin(), this->go_listener_start_.end() - 1);
+  for (size_t k = 0; k < objects.size(); k++) {
+    if (objects[k] < n) {
+      this->go_listeners_[next[objects[k]]++] = k;
+    }
+  }
+  this->listener_table_stale_ = false;
+}
+
+void KNXTPComponent::flush_pending_values_() {
+  // Index loop: an entity may send (and loop back a value) while it publishes
+  for (size_t i = 0; i < this->dirty_listeners_.size(); i++) {
+    uint16_t ga = this->dirty_listeners_[i].first;
+    KNXListener *listener = this->dirty_listeners_[i].second;
+    if (!listener->dirty) {
+      continue;  // Superseded by a value delivered immediately
+    }
+    listener->dirty = false;
+    listener->entity->on_knx_group_value(listener->role, ga, listener->pending, listener->pending_len);
+  }
+  this->dirty_listeners_.clear();
 }
 
-void KNXTPComponent::group_object_callback_(uint16_t ga, const uint8_t *data, uint8_t len) {
+void KNXTPComponent::group_object_callback_(size_t object, const uint8_t *data, uint8_t len) {
+  uint16_t ga = this->group_objects_[object].ga;
+  // Another device wrote this GA: the value we sent last is no longer on the bus
+  if (!this->sent_values_.empty()) {
+    this->sent_values_[object].len = SentValue::NONE;
+  }
+  // Nobody listens on most GAs: one bit load, before any other receive work
+  if (!this->rx_filter_.contains(ga)) {
+    return;
+  }
+
   // Input validation: check for null pointer
   if (data == nullptr) {
     ESP_LOGE(TAG, "Null data pointer in group_object_callback_ for GA %u", ga);
@@ -330,18 +764,11 @@ void KNXTPComponent::group_object_callback_(uint16_t ga, const uint8_t *data, ui
     return;
   }
 
-  // Convert GA to string format
-  std::string ga_str = this->int_to_address_(ga);
+  ESP_LOGV(TAG, "Group object callback for GA %u/%u/%u with %d bytes",
+           (ga >> 11) & 0x1F, (ga >> 8) & 0x07, ga & 0xFF, len);
 
-  // Convert data to vector with pre-allocation for efficiency
-  std::vector<uint8_t> data_vec;
-  data_vec.reserve(len);  // Pre-allocate to avoid reallocation
-  data_vec.assign(data, data + len);
-
-  ESP_LOGD(TAG, "Group object callback for GA %s with %d bytes", ga_str.c_str(), len);
-
-  // Notify entities (pass both string and int to avoid redundant conversion)
-  this->notify_entities_(ga_str, ga, data_vec);
+  // Hand the stack's buffer straight to the listeners (no string/vector copies)
+  this->notify_entities_(object, ga, data, len);
 }
 
 uint8_t KNXTPComponent::calculate_checksum_(const std::vector<uint8_t> &data) {
@@ -359,14 +786,6 @@ uint8_t KNXTPComponent::calculate_checksum_(const std::vector<uint8_t> &data) {
   return ~checksum;
 }
 
-std::vector<uint8_t> KNXTPComponent::encode_address_(const std::string &address) {
-  uint16_t addr_int = this->address_to_int_(address);
-  return {
-    static_cast<uint8_t>(addr_int >> 8),
-    static_cast<uint8_t>(addr_int & 0xFF)
-  };
-}
-
 std::string KNXTPComponent::decode_address_(const std::vector<uint8_t> &data, size_t offset) {
   if (offset + 1 >= data.size()) {
     return "0.0.0";
@@ -376,6 +795,15 @@ std::string KNXTPComponent::decode_address_(const std::vector<uint8_t> &data, si
   return this->int_to_address_(encoded);
 }
 
+#if USE_KNX_ADDRESS_PARSER
+std::vector<uint8_t> KNXTPComponent::encode_address_(const std::string &address) {
+  uint16_t addr_int = this->address_to_int_(address);
+  return {
+    static_cast<uint8_t>(addr_int >> 8),
+    static_cast<uint8_t>(addr_int & 0xFF)
+  };
+}
+
 uint16_t KNXTPComponent::address_to_int_(const std::string &address) {
   // Parse address format: "area.line.device" or "area/line/device"
 
@@ -451,6 +879,59 @@ uint16_t KNXTPComponent::address_to_int_(const std::string &address) {
   return encoded;
 }
 
+uint16_t KNXTPComponent::parse_physical_address_(const std::string &address) {
+  // Parse format: "area.line.device" or "area/line/device"
+  // Example: "1.1.200" -> 0x1100 + 200 = 0x11C8
+
+  std::string addr = address;
+  // Replace / with .
+  for (char &c : addr) {
+    if (c == '/') c = '.';
+  }
+
+  size_t pos1 = addr.find('.');
+  size_t pos2 = addr.find('.', pos1 + 1);
+
+  if (pos1 == std::string::npos || pos2 == std::string::npos) {
+    ESP_LOGE(TAG, "Invalid physical address format: %s", address.c_str());
+    return 0;
+  }
+
+  // Manual validation to avoid exceptions (ESP-IDF uses -fno-exceptions)
+  std::string area_str = addr.substr(0, pos1);
+  std::string line_str = addr.substr(pos1 + 1, pos2 - pos1 - 1);
+  std::string device_str = addr.substr(pos2 + 1);
+
+  // Check if all parts are numeric
+  bool valid = true;
+  for (char c : area_str) if (!isdigit(c)) valid = false;
+  for (char c : line_str) if (!isdigit(c)) valid = false;
+  for (char c : device_str) if (!isdigit(c)) valid = false;
+
+  if (!valid || area_str.empty() || line_str.empty() || device_str.empty()) {
+    ESP_LOGE(TAG, "Invalid physical address (non-numeric): %s", address.c_str());
+    return 0;
+  }
+
+  // Convert with bounds checking
+  long area_long = atol(area_str.c_str());
+  long line_long = atol(line_str.c_str());
+  long device_long = atol(device_str.c_str());
+
+  if (area_long < 0 || area_long > 15 || line_long < 0 || line_long > 15 || device_long < 0 || device_long > 255) {
+    ESP_LOGE(TAG, "Physical address out of range: %s", address.c_str());
+    return 0;
+  }
+
+  uint8_t area = static_cast<uint8_t>(area_long);
+  uint8_t line = static_cast<uint8_t>(line_long);
+  uint8_t device = static_cast<uint8_t>(device_long);
+
+  // Physical address format: AAAA LLLL DDDDDDDD (4+4+8 bits)
+  return ((area & 0x0F) << 12) | ((line & 0x0F) << 8) | (device & 0xFF);
+}
+#endif
+
 std::string KNXTPComponent::int_to_address_(uint16_t address) {
   int area = (address >> 11) & 0x1F;
   int line = (address >> 8) & 0x07;
@@ -470,7 +951,7 @@ std::string KNXTPComponent::int_to_address_(uint16_t address) {
 
 void KNXTPComponent::broadcast_time_() {
 #ifdef USE_TIME
-  if (this->time_source_ == nullptr || this->time_broadcast_ga_id_.empty()) {
+  if (this->time_source_ == nullptr || this->time_broadcast_ga_ == nullptr) {
     return;
   }
 
@@ -505,8 +986,8 @@ void KNXTPComponent::broadcast_time_() {
   dt.quality = 0;  // Good quality
 
   // Encode and send
-  auto telegram = DPT::encode_dpt19(dt);
-  this->send_group_write(this->time_broadcast_ga_id_, telegram);
+  auto telegram = DPT::encode_dpt19_fixed(dt);
+  this->send_group_write(this->time_broadcast_ga_->get_address_int(), telegram);
 
   ESP_LOGD(TAG, "Broadcasted time: %04d-%02d-%02d %02d:%02d:%02d%s",
            dt.year, dt.month, dt.day, dt.hour, dt.minute, dt.second,
@@ -518,13 +999,42 @@ void KNXTPComponent::broadcast_time_() {
 }
 
 #if USE_KNX_ON_GROUP_ADDRESS
-void KNXTPComponent::add_on_group_address_callback(uint16_t ga_int,
-                                                    std::function<void(std::vector<uint8_t>)> &&callback) {
-  // Add callback to hash map (creates entry if doesn't exist)
-  this->ga_callbacks_[ga_int].add(std::move(callback));
+void KNXTPComponent::add_on_group_address_callback(const GroupAddressMatch &match,
+                                                    std::function<void(const std::vector<uint8_t> &)> &&callback) {
+  this->ga_callbacks_.push_back({match, std::move(callback)});
+  // Registered from a lambda after setup: refresh the dispatch table
+  if (!this->go_callback_start_.empty()) {
+    this->build_callback_table_();
+  }
+
+  if (match.mask == 0xFFFF) {
+    ESP_LOGD(TAG, "Registered on_group_address callback for GA 0x%04X (%s)", match.value,
+             this->int_to_address_(match.value).c_str());
+  } else {
+    ESP_LOGD(TAG, "Registered on_group_address callback for GA mask 0x%04X/0x%04X, range %s - %s", match.mask,
+             match.value, this->int_to_address_(match.low).c_str(), this->int_to_address_(match.high).c_str());
+  }
+}
 
-  ESP_LOGD(TAG, "Registered on_group_address callback for GA 0x%04X (%s)",
-           ga_int, this->int_to_address_(ga_int).c_str());
+void KNXTPComponent::build_callback_table_() {
+  // Matched once, here, against every group object (the stack delivers no other
+  // GA): group object i gets a contiguous slice of trigger indices, in
+  // registration order, and its GA passes the receive filter
+  size_t n = this->group_object_count_;
+  this->go_callback_start_.assign(n + 1, 0);
+  this->go_callbacks_.clear();
+  for (size_t i = 0; i < n; i++) {
+    uint16_t ga = this->group_objects_[i].ga;
+    this->go_callback_start_[i] = this->go_callbacks_.size();
+    for (size_t c = 0; c < this->ga_callbacks_.size(); c++) {
+      if (this->ga_callbacks_[c].match.matches(ga)) {
+        this->go_callbacks_.push_back(c);
+        this->rx_filter_.add(ga);
+      }
+    }
+  }
+  this->go_callback_start_[n] = this->go_callbacks_.size();
+  this->go_callbacks_.shrink_to_fit();
 }
 #endif
 
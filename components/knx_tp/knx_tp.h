@@ -6,9 +6,11 @@
 #include "esphome/core/automation.h"
 #include "group_address.h"
 #include "dpt.h"
+#include "ga_filter.h"
+#include "tx_queue.h"
 #include <vector>
 #include <string>
-#include <unordered_map>
+#include <utility>
 
 // Define MASK_VERSION before including KNX headers
 #ifndef MASK_VERSION
@@ -26,7 +28,7 @@
 #endif
 
 // Forward declarations for Thelsing KNX stack
-class Esp32IdfPlatform;
+class Platform;  // Esp32IdfPlatform on device, HostTPPlatform on the host build
 class Bau07B0;  // BAU class is in global namespace, not knx::
 
 namespace esphome {
@@ -40,6 +42,57 @@ namespace knx_tp {
 
 class KNXEntity;
 
+// Largest payload publish coalescing buffers (DPT 16.001, 14 bytes, is the
+// largest an entity decodes); longer telegrams are delivered immediately
+static constexpr uint8_t KNX_COALESCE_MAX_PAYLOAD = 14;
+
+/**
+ * Dispatch index entry: an entity listening on a group address, plus the
+ * role that address plays for it (e.g. climate setpoint vs. mode feedback)
+ */
+struct KNXListener {
+  KNXEntity *entity;
+  uint16_t ga;
+  uint8_t role;
+  // Publish coalescing: latest payload received this loop, delivered at its end
+  bool dirty;
+  uint8_t pending_len;
+  uint8_t pending[KNX_COALESCE_MAX_PAYLOAD];
+};
+
+/**
+ * Send deduplication: the last value written to a group object, and when
+ */
+struct SentValue {
+  static constexpr uint8_t NONE = 0xFF;  // Nothing sent, or the bus value changed since
+
+  uint32_t time;
+  uint8_t len;
+  uint8_t data[KNXFrame::MAX_DATA];
+};
+
+#if USE_KNX_ON_GROUP_ADDRESS
+/**
+ * Group addresses an on_group_address trigger fires for: (ga & mask) == value
+ * and low <= ga <= high. Codegen compiles wildcard (a level given as '*') and
+ * range (3/2/10-40) patterns to one or a few of these
+ */
+struct GroupAddressMatch {
+  uint16_t mask;
+  uint16_t value;
+  uint16_t low;
+  uint16_t high;
+
+  bool matches(uint16_t ga) const { return (ga & mask) == value && ga >= low && ga <= high; }
+};
+
+// An on_group_address trigger
+struct GroupAddressCallback {
+  GroupAddressMatch match;
+  std::function<void(const std::vector<uint8_t> &)> callback;
+};
+#endif
+
 /**
  * Main KNX TP Component
  * Handles KNX Twisted Pair communication and entity management
@@ -56,10 +109,32 @@ class KNXTPComponent : public Component, public uart::UARTDevice {
   ~KNXTPComponent();
 
   // Configuration
+  // Individual address, AAAA.LLLL.DDDDDDDD (emitted by codegen as a constant)
+  void set_physical_address(uint16_t address) { physical_address_int_ = address; }
+#if USE_KNX_ADDRESS_PARSER
   void set_physical_address(const std::string &address);
+#endif
   void register_group_address(GroupAddress *ga);
+  // Group object table generated by codegen (sorted by address, constexpr)
+  void set_group_objects(const GroupObjectEntry *objects, size_t count) {
+    group_objects_ = objects;
+    group_object_count_ = count;
+  }
   void register_entity(KNXEntity *entity);
+  // Listeners receive the telegrams of a GA. Group object flags and sizes are
+  // worked out at codegen time (use_group_address() in __init__.py).
+  // Entities get their GroupAddress pointers from codegen; the string
+  // overload resolves an id first, for lambdas
+  void register_listener(GroupAddress *ga, KNXEntity *entity, uint8_t role);
+  void register_listener(const std::string &ga_id, KNXEntity *entity, uint8_t role);
+  // Publish coalescing: values received during one loop() reach each listener
+  // once, at its end, with the latest payload (bursty GAs: dimmer ramps, weather stations)
+  void set_coalesce_publish(bool coalesce) { coalesce_publish_ = coalesce; }
   void set_uart_parent(uart::UARTComponent *parent);
+#ifdef USE_HOST
+  // Host build: serial device or pty the TP-UART is reached through
+  void set_host_uart_path(const std::string &path) { host_uart_path_ = path; }
+#endif
 
   // SAV pin configuration (BCU connection detection)
   void set_sav_pin(GPIOPin *pin) { sav_pin_ = pin; }
@@ -67,43 +142,134 @@ class KNXTPComponent : public Component, public uart::UARTDevice {
 
   // Time broadcast configuration
   void set_time_source(time::RealTimeClock *time_source) { time_source_ = time_source; }
-  void set_time_broadcast_ga(const std::string &ga_id) { time_broadcast_ga_id_ = ga_id; }
+  void set_time_broadcast_ga(GroupAddress *ga) { time_broadcast_ga_ = ga; }
   void set_time_broadcast_interval(uint32_t interval_ms) { time_broadcast_interval_ = interval_ms; }
 
+  // Transmit pacing: minimum time between two frames handed to the bus
+  void set_tx_interval(uint32_t interval_ms) { tx_interval_ = interval_ms; }
+  // Send deduplication: skip a write whose payload equals the last one sent to
+  // that GA less than window_ms ago (0 = off)
+  void set_send_dedup_window(uint32_t window_ms) { send_dedup_window_ = window_ms; }
+
   // Communication
+  // Frames are queued by priority and sent from loop(), one at a time;
+  // on_complete (optional) gets the bus confirmation of each frame
+#if USE_KNX_ADDRESS_PARSER
   void send_telegram(const std::string &dest_addr, const std::vector<uint8_t> &data);
-  void send_group_write(const std::string &ga_id, const std::vector<uint8_t> &data);
-  void send_group_read(const std::string &ga_id);
-  void send_group_response(const std::string &ga_id, const std::vector<uint8_t> &data);
+#endif
+  // The payload is copied into the queue: (pointer, length) and std::array
+  // (DPT::encode_*_fixed) overloads send without allocating.
+  // The uint16_t overloads take the raw group address (GroupAddress::get_address_int())
+  // and skip the id lookup; the string ones resolve a GA id first
+  void send_group_write(uint16_t ga, const uint8_t *data, size_t len, KNXPriority priority = KNX_PRIORITY_LOW,
+                        KNXTxCallback &&on_complete = nullptr) {
+    this->queue_frame_(ga, KNXService::WRITE, data, len, priority, std::move(on_complete));
+  }
+  template<size_t N>
+  void send_group_write(uint16_t ga, const std::array<uint8_t, N> &data, KNXPriority priority = KNX_PRIORITY_LOW,
+                        KNXTxCallback &&on_complete = nullptr) {
+    this->queue_frame_(ga, KNXService::WRITE, data.data(), N, priority, std::move(on_complete));
+  }
+  void send_group_write(const std::string &ga_id, const uint8_t *data, size_t len,
+                        KNXPriority priority = KNX_PRIORITY_LOW, KNXTxCallback &&on_complete = nullptr);
+  void send_group_write(const std::string &ga_id, const std::vector<uint8_t> &data,
+                        KNXPriority priority = KNX_PRIORITY_LOW, KNXTxCallback &&on_complete = nullptr) {
+    this->send_group_write(ga_id, data.data(), data.size(), priority, std::move(on_complete));
+  }
+  template<size_t N>
+  void send_group_write(const std::string &ga_id, const std::array<uint8_t, N> &data,
+                        KNXPriority priority = KNX_PRIORITY_LOW, KNXTxCallback &&on_complete = nullptr) {
+    this->send_group_write(ga_id, data.data(), N, priority, std::move(on_complete));
+  }
+  void send_group_read(uint16_t ga, KNXPriority priority = KNX_PRIORITY_LOW, KNXTxCallback &&on_complete = nullptr) {
+    this->queue_frame_(ga, KNXService::READ, nullptr, 0, priority, std::move(on_complete));
+  }
+  void send_group_read(const std::string &ga_id, KNXPriority priority = KNX_PRIORITY_LOW,
+                       KNXTxCallback &&on_complete = nullptr);
+  // The stack answers GroupValue_Read itself from the group object, so a
+  // response stores the value it answers with (the GA needs the read flag)
+  void send_group_response(uint16_t ga, const uint8_t *data, size_t len, KNXPriority priority = KNX_PRIORITY_LOW,
+                           KNXTxCallback &&on_complete = nullptr) {
+    this->queue_frame_(ga, KNXService::RESPONSE, data, len, priority, std::move(on_complete));
+  }
+  template<size_t N>
+  void send_group_response(uint16_t ga, const std::array<uint8_t, N> &data, KNXPriority priority = KNX_PRIORITY_LOW,
+                           KNXTxCallback &&on_complete = nullptr) {
+    this->queue_frame_(ga, KNXService::RESPONSE, data.data(), N, priority, std::move(on_complete));
+  }
+  void send_group_response(const std::string &ga_id, const uint8_t *data, size_t len,
+                           KNXPriority priority = KNX_PRIORITY_LOW, KNXTxCallback &&on_complete = nullptr);
+  void send_group_response(const std::string &ga_id, const std::vector<uint8_t> &data,
+                           KNXPriority priority = KNX_PRIORITY_LOW, KNXTxCallback &&on_complete = nullptr) {
+    this->send_group_response(ga_id, data.data(), data.size(), priority, std::move(on_complete));
+  }
+  template<size_t N>
+  void send_group_response(const std::string &ga_id, const std::array<uint8_t, N> &data,
+                           KNXPriority priority = KNX_PRIORITY_LOW, KNXTxCallback &&on_complete = nullptr) {
+    this->send_group_response(ga_id, data.data(), N, priority, std::move(on_complete));
+  }
 
   // Accessors
   GroupAddress *get_group_address(const std::string &id);
-  std::string get_physical_address() const { return physical_address_; }
+  std::string get_physical_address() const;
+  uint16_t get_physical_address_int() const { return physical_address_int_; }
 
   // Thelsing KNX stack integration
   Bau07B0* get_bau() { return bau_; }
 
 #if USE_KNX_ON_TELEGRAM
   // Register generic telegram trigger (called for ALL telegrams)
-  void add_on_telegram_callback(std::function<void(std::string, std::vector<uint8_t>)> &&callback) {
+  void add_on_telegram_callback(std::function<void(const std::string &, const std::vector<uint8_t> &)> &&callback) {
     this->telegram_callbacks_.add(std::move(callback));
+    this->has_telegram_callbacks_ = true;
+    this->rx_filter_.add_all();
   }
 #endif
 
 #if USE_KNX_ON_GROUP_ADDRESS
   // Register group address specific trigger (called only for matching GA)
-  void add_on_group_address_callback(uint16_t ga_int, std::function<void(std::vector<uint8_t>)> &&callback);
+  void add_on_group_address_callback(uint16_t ga_int, std::function<void(const std::vector<uint8_t> &)> &&callback) {
+    this->add_on_group_address_callback(GroupAddressMatch{0xFFFF, ga_int, 0x0000, 0xFFFF}, std::move(callback));
+  }
+  // Same for a set of GAs (wildcards and ranges)
+  void add_on_group_address_callback(const GroupAddressMatch &match,
+                                     std::function<void(const std::vector<uint8_t> &)> &&callback);
+  // Number of triggers codegen will register, so the table is allocated once
+  void reserve_group_address_callbacks(size_t count) { this->ga_callbacks_.reserve(count); }
 #endif
 
  protected:
-  std::string physical_address_;
-  std::vector<GroupAddress *> group_addresses_;
-  std::unordered_map<std::string, GroupAddress *> ga_lookup_;  // O(1) lookup by ID
+  std::vector<GroupAddress *> group_addresses_;  // Sorted by id (binary search)
   std::vector<KNXEntity *> entities_;
+  // Legacy entities (no listeners): every telegram, through on_knx_telegram()
+  std::vector<KNXEntity *> telegram_entities_;
+  // Entities (and roles) listening on a GA, in registration order.
+  // Filled by register_listener() while entities run their setup()
+  std::vector<KNXListener> listeners_;
+  // Receive dispatch index, rebuilt on the first telegram after a registration:
+  // the listeners of group object i are listeners_[go_listeners_[k]],
+  // go_listener_start_[i] <= k < go_listener_start_[i + 1]
+  std::vector<uint16_t> go_listener_start_;
+  std::vector<uint16_t> go_listeners_;
+  bool listener_table_stale_{true};
+  void build_listener_table_();
+  // GAs with a listener or trigger: checked first on every received telegram
+  GAFilter rx_filter_;
+  // Publish coalescing: listeners holding a pending value, flushed at the end of loop()
+  bool coalesce_publish_{false};
+  std::vector<std::pair<uint16_t, KNXListener *>> dirty_listeners_;
+  void flush_pending_values_();
+  // Group objects bound to our GAs: asap N (1-based) belongs to group_objects_[N - 1].
+  // Sorted, like the address table it mirrors; lives in flash
+  const GroupObjectEntry *group_objects_{nullptr};
+  size_t group_object_count_{0};
 
   // Thelsing KNX stack objects
   Bau07B0 *bau_{nullptr};  // BAU is in global namespace
-  Esp32IdfPlatform *platform_{nullptr};
+  Platform *platform_{nullptr};
+#ifdef USE_HOST
+  std::string host_uart_path_;
+#endif
   uint16_t physical_address_int_{0};
 
   // SAV pin for BCU connection detection
@@ -113,49 +279,101 @@ class KNXTPComponent : public Component, public uart::UARTDevice {
 
   // Time broadcast
   time::RealTimeClock *time_source_{nullptr};
-  std::string time_broadcast_ga_id_;
+  GroupAddress *time_broadcast_ga_{nullptr};
   uint32_t time_broadcast_interval_{60000};  // Default: 60 seconds
   uint32_t last_time_broadcast_{0};
   void broadcast_time_();
 
+  // Transmit path: one frame on the bus at a time, at most one per tx_interval_
+  TxQueue tx_queue_;
+  KNXFrame *tx_in_flight_{nullptr};
+  uint32_t tx_interval_{20};  // ~50 frames/s, the TP1 9600 baud budget
+  uint32_t tx_last_{0};
+  // Send deduplication: one entry per group object, allocated when enabled
+  uint32_t send_dedup_window_{0};
+  std::vector<SentValue> sent_values_;
+  // Loaded group object table: the stack sends with the descriptor's priority
+  uint8_t *go_table_{nullptr};
+  bool is_duplicate_write_(size_t object, const uint8_t *data, size_t len, uint32_t now) const;
+  void queue_frame_(uint16_t ga, KNXService service, const uint8_t *data, size_t len, KNXPriority priority,
+                    KNXTxCallback &&on_complete);
+  void process_tx_queue_();
+  bool start_frame_(KNXFrame *frame);
+  void complete_frame_(bool success);
+  uint16_t find_asap_(uint16_t ga) const;
+
   // Telegram processing
   void parse_telegram_(const std::vector<uint8_t> &telegram);
-  void notify_entities_(const std::string &ga, uint16_t ga_int, const std::vector<uint8_t> &data);
-  void group_object_callback_(uint16_t ga, const uint8_t *data, uint8_t len);
+  void notify_entities_(size_t object, uint16_t ga, const uint8_t *data, uint8_t len);
+  void group_object_callback_(size_t object, const uint8_t *data, uint8_t len);
+  bool configure_group_objects_();
+#if USE_KNX_ON_GROUP_ADDRESS
+  void build_callback_table_();
+#endif
+  const GroupObjectEntry *find_group_object_(uint16_t ga) const;
 
   // Utilities
   uint8_t calculate_checksum_(const std::vector<uint8_t> &data);
-  std::vector<uint8_t> encode_address_(const std::string &address);
   std::string decode_address_(const std::vector<uint8_t> &data, size_t offset);
-  uint16_t address_to_int_(const std::string &address);
   std::string int_to_address_(uint16_t address);
+#if USE_KNX_ADDRESS_PARSER
+  std::vector<uint8_t> encode_address_(const std::string &address);
+  uint16_t address_to_int_(const std::string &address);
+  uint16_t parse_physical_address_(const std::string &address);
+#endif
 
 #if USE_KNX_ON_TELEGRAM
   // Generic telegram triggers (called for every telegram)
-  CallbackManager<void(std::string, std::vector<uint8_t>)> telegram_callbacks_;
+  CallbackManager<void(const std::string &, const std::vector<uint8_t> &)> telegram_callbacks_;
+  bool has_telegram_callbacks_{false};  // Skip building string/vector arguments when unused
 #endif
 
 #if USE_KNX_ON_GROUP_ADDRESS
-  // Group address specific triggers (O(1) lookup via hash map)
-  std::unordered_map<uint16_t, CallbackManager<void(std::vector<uint8_t>)>> ga_callbacks_;
+  // Group address specific triggers, in registration order
+  std::vector<GroupAddressCallback> ga_callbacks_;
+  // Flat dispatch table built by build_callback_table_(): the triggers of group
+  // object i are ga_callbacks_[go_callbacks_[k]], go_callback_start_[i] <= k < go_callback_start_[i + 1]
+  std::vector<uint16_t> go_callback_start_;
+  std::vector<uint16_t> go_callbacks_;
+  std::vector<uint8_t> callback_data_;  // Trigger argument, reused: no allocation per telegram
 #endif
 };
 
 /**
  * Base class for all KNX entities
- * Nota: std::vector<uint8_t> per telegrammi usa Small Buffer Optimization (SBO)
- * per telegrammi < 16 bytes, quindi non alloca heap per la maggior parte dei casi
+ * Entities subscribe to their group addresses with register_listener() and
+ * only receive telegrams for those, tagged with the role they registered.
+ * Entities written against on_knx_telegram() keep working: they receive
+ * every telegram, as registered entities always did
  */
 class KNXEntity {
  public:
   virtual ~KNXEntity() = default;
 
   /**
-   * Called when a KNX telegram is received
+   * Called when a KNX telegram is received on a subscribed group address
+   * The payload points into the stack's buffer (no copy) and is only valid
+   * for the duration of the call.
+   * @param role Role passed to register_listener() for this group address
    * @param ga Group address that triggered this
    * @param data Payload data from the telegram
+   * @param len Payload length in bytes
+   */
+  virtual void on_knx_group_value(uint8_t role, uint16_t ga, const uint8_t *data, uint8_t len) {
+    // Compatibility shim: forward to the legacy signature (allocates)
+    this->on_knx_telegram(GroupAddress::to_string(ga), std::vector<uint8_t>(data, data + len));
+  }
+
+  /**
+   * Legacy receive callback, with the original signature. Entities that do
+   * not use listeners (uses_listeners() false) get every telegram here, as
+   * before the dispatch index; override on_knx_group_value() instead to
+   * avoid the per-telegram string and vector.
    */
-  virtual void on_knx_telegram(const std::string &ga, const std::vector<uint8_t> &data) = 0;
+  virtual void on_knx_telegram(const std::string &ga, const std::vector<uint8_t> &data) {}
+
+  // True for entities that override on_knx_group_value() and subscribe with register_listener()
+  virtual bool uses_listeners() const { return false; }
 
   void set_knx_component(KNXTPComponent *knx) { knx_ = knx; }
 
@@ -7,11 +7,12 @@ class KNXNumber : public number::Number, public Component, public KNXEntity {
  public:
   void setup() override;
   void dump_config() override;
-  void set_command_ga_id(const std::string &ga_id) { command_ga_id_ = ga_id; }
-  void set_state_ga_id(const std::string &ga_id) { state_ga_id_ = ga_id; }
-  void on_knx_telegram(const std::string &ga, const std::vector<uint8_t> &data) override;
+  void set_command_ga(GroupAddress *ga) { command_ga_ = ga; }
+  void set_state_ga(GroupAddress *ga) { state_ga_ = ga; }
+  void on_knx_group_value(uint8_t role, uint16_t ga, const uint8_t *data, uint8_t len) override;
+  bool uses_listeners() const override { return true; }
  protected:
   void control(float value) override;
-  std::string command_ga_id_, state_ga_id_;
+  GroupAddress *command_ga_{nullptr}, *state_ga_{nullptr};
 };
 }}
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/core/component.h"
 #include "knx_tp.h"
+#include "dpt_registry.h"
 
 namespace esphome {
 namespace knx_tp {
@@ -32,16 +33,60 @@ class KNXSensor : public sensor::Sensor, public Component, public KNXEntity {
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
   
-  void set_state_ga_id(const std::string &ga_id) { state_ga_id_ = ga_id; }
+  void set_state_ga(GroupAddress *ga) { state_ga_ = ga; }
   void set_sensor_type(KNXSensorType type) { sensor_type_ = type; }
+  void set_dpt(const DPTDescriptor *dpt) { dpt_ = dpt; }  // Any scalar DPT, overrides the type
+
+  // Publish filter, applied to the decoded value before any log or publish.
+  // Deadband: publish only when the value moved by more than max(deadband,
+  // deadband_percent of the last value); once set, repeated values never pass
+  void set_deadband(float deadband) {
+    deadband_ = deadband;
+    has_deadband_ = true;
+  }
+  void set_deadband_percent(float percent) {
+    deadband_percent_ = percent;
+    has_deadband_ = true;
+  }
+  // Values arriving sooner than this after a publish wait for it (last one wins)
+  void set_min_interval(uint32_t min_interval) { min_interval_ = min_interval; }
+  // After this long without a publish, the next value is published even inside the deadband
+  void set_max_interval(uint32_t max_interval) { max_interval_ = max_interval; }
   
-  void on_knx_telegram(const std::string &ga, const std::vector<uint8_t> &data) override;
+  void on_knx_group_value(uint8_t role, uint16_t ga, const uint8_t *data, uint8_t len) override;
+  bool uses_listeners() const override { return true; }
 
  protected:
-  std::string state_ga_id_;
+  GroupAddress *state_ga_{nullptr};
   KNXSensorType sensor_type_{KNX_SENSOR_TYPE_GENERIC_2BYTE};
+  const DPTDescriptor *dpt_{nullptr};
   
+  // Publish filter
+  bool has_deadband_{false};
+  float deadband_{0.0f};
+  float deadband_percent_{0.0f};
+  uint32_t min_interval_{0};
+  uint32_t max_interval_{0};
+  bool has_value_{false};     // A value passed the deadband
+  float last_value_{0.0f};    // Value that last passed the deadband
+  bool has_published_{false};
+  uint32_t last_publish_{0};  // millis() of the last publish
+  bool pending_{false};       // A value waits for min_interval
+  float pending_value_{0.0f};
+
   const char* sensor_type_to_string(KNXSensorType type);
+  static const DPTDescriptor *type_descriptor_(KNXSensorType type);
+  bool max_interval_elapsed_() const {
+    return this->max_interval_ != 0 && this->has_published_ && millis() - this->last_publish_ >= this->max_interval_;
+  }
+  void publish_filtered_(float value);
+#if USE_KNX_FIXED_POINT
+  // Deadband in centi-units and hundredths of a percent: integer-only filter
+  int32_t deadband_centi_{0};
+  int32_t deadband_percent_centi_{0};
+  int32_t last_centi_{0};
+  void publish_centi_(int32_t centi);
+#endif
 };
 
 }  // namespace knx_tp
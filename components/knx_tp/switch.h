@@ -17,17 +17,18 @@ class KNXSwitch : public switch_::Switch, public Component, public KNXEntity {
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
   
-  void set_command_ga_id(const std::string &ga_id) { command_ga_id_ = ga_id; }
-  void set_state_ga_id(const std::string &ga_id) { state_ga_id_ = ga_id; }
+  void set_command_ga(GroupAddress *ga) { command_ga_ = ga; }
+  void set_state_ga(GroupAddress *ga) { state_ga_ = ga; }
   void set_invert(bool invert) { invert_ = invert; }
   
-  void on_knx_telegram(const std::string &ga, const std::vector<uint8_t> &data) override;
+  void on_knx_group_value(uint8_t role, uint16_t ga, const uint8_t *data, uint8_t len) override;
+  bool uses_listeners() const override { return true; }
 
  protected:
   void write_state(bool state) override;
   
-  std::string command_ga_id_;
-  std::string state_ga_id_;
+  GroupAddress *command_ga_{nullptr};
+  GroupAddress *state_ga_{nullptr};
   bool invert_{false};
 };
 
@@ -1,7 +1,9 @@
 #include "dpt.h"
+#include "dpt_registry.h"
 #include <cmath>
 #include <cassert>
 #include <cstdio>
+#include <algorithm>
 #include <limits>
 
 using namespace esphome::knx_tp;
@@ -42,6 +44,22 @@ void test_dpt1_bool() {
   TEST_ASSERT(DPT::decode_dpt1({}) == false, "DPT1 decode empty returns false");
 }
 
+void test_dpt3_dimming() {
+  printf("\n=== Testing DPT 3.007 (Control Dimming) ===\n");
+
+  TEST_ASSERT(DPT::encode_dpt3_fixed(true, 1)[0] == 0x09, "DPT3 encode increase, full range");
+  TEST_ASSERT(DPT::encode_dpt3_fixed(false, 1)[0] == 0x01, "DPT3 encode decrease, full range");
+  TEST_ASSERT(DPT::encode_dpt3_fixed(true, 0)[0] == 0x08, "DPT3 encode stop");
+  TEST_ASSERT(DPT::encode_dpt3_fixed(false, 0x0F)[0] == 0x07, "DPT3 encode masks step code");
+
+  uint8_t raw = 0x0B;
+  auto control = DPT::decode_dpt3(&raw, 1);
+  TEST_ASSERT(control.increase && control.step_code == 3, "DPT3 decode increase, step 3");
+  raw = 0x00;
+  control = DPT::decode_dpt3(&raw, 1);
+  TEST_ASSERT(!control.increase && control.step_code == 0, "DPT3 decode stop");
+}
+
 void test_dpt5_uint8() {
   printf("\n=== Testing DPT 5 (8-bit unsigned) ===\n");
 
@@ -160,6 +178,108 @@ void test_dpt9_float() {
   TEST_ASSERT(DPT::decode_dpt9({0x12}) == 0.0f, "DPT9 decode 1-byte returns 0");
 }
 
+void test_dpt9_exhaustive() {
+  printf("\n=== Testing DPT 9 (all 65536 raw values) ===\n");
+
+  int decode_errors = 0, roundtrip_errors = 0, rounding_errors = 0;
+  for (uint32_t raw = 0; raw <= 0xFFFF; raw++) {
+    uint8_t data[2] = {static_cast<uint8_t>(raw >> 8), static_cast<uint8_t>(raw & 0xFF)};
+    int32_t mantissa = (raw & 0x8000) ? static_cast<int32_t>(raw & 0x7FF) - 2048 : static_cast<int32_t>(raw & 0x7FF);
+    int exponent = (raw >> 11) & 0x0F;
+
+    // Decoder: exactly 0.01 * M * 2^E in float
+    float value = DPT::decode_dpt9(data, sizeof(data));
+    if (value != std::ldexp(0.01f * mantissa, exponent)) {
+      decode_errors++;
+    }
+
+    // Encoder: every decoded value encodes back to the same value
+    auto encoded = DPT::encode_dpt9_fixed(value);
+    if (DPT::decode_dpt9(encoded.data(), encoded.size()) != value) {
+      roundtrip_errors++;
+    }
+
+    // Encoder: halfway between this value and the next step rounds to within half a step
+    float step = std::ldexp(0.01f, exponent);
+    float probe = value + 0.3f * step;
+    if (exponent < 15 && std::fabs(probe) < 670000.0f) {
+      encoded = DPT::encode_dpt9_fixed(probe);
+      float back = DPT::decode_dpt9(encoded.data(), encoded.size());
+      if (std::fabs(back - probe) > 0.5f * step * 1.0001f) {
+        rounding_errors++;
+      }
+    }
+  }
+  TEST_ASSERT(decode_errors == 0, "DPT9 decodes all 65536 raw values exactly");
+  TEST_ASSERT(roundtrip_errors == 0, "DPT9 encode(decode(raw)) round-trips for all raw values");
+  TEST_ASSERT(rounding_errors == 0, "DPT9 encoder rounds to nearest");
+
+  // Sign bit alone is -2048 * 0.01, not 0
+  uint8_t min_mantissa[2] = {0x80, 0x00};
+  TEST_FLOAT_EQUAL(DPT::decode_dpt9(min_mantissa, 2), -20.48f, 0.001f, "DPT9 decode 0x8000 = -20.48");
+
+  // Rounding, not truncation
+  auto encoded = DPT::encode_dpt9_fixed(0.019f);
+  TEST_ASSERT(encoded[0] == 0x00 && encoded[1] == 0x02, "DPT9 0.019 rounds to 0.02");
+  encoded = DPT::encode_dpt9_fixed(-0.019f);
+  TEST_FLOAT_EQUAL(DPT::decode_dpt9(encoded.data(), encoded.size()), -0.02f, 0.0001f, "DPT9 -0.019 rounds to -0.02");
+  // Carry into the next exponent: 20.479 is 2047.9 centi-units
+  encoded = DPT::encode_dpt9_fixed(20.479f);
+  TEST_FLOAT_EQUAL(DPT::decode_dpt9(encoded.data(), encoded.size()), 20.48f, 0.001f, "DPT9 rounding carries exponent");
+}
+
+void test_centi_codecs() {
+  printf("\n=== Testing fixed-point (centi-unit) codecs ===\n");
+
+  // DPT 9: integer decode is exact, integer encode matches the float encoder
+  int decode_errors = 0, encode_errors = 0;
+  for (uint32_t raw = 0; raw <= 0xFFFF; raw++) {
+    uint8_t data[2] = {static_cast<uint8_t>(raw >> 8), static_cast<uint8_t>(raw & 0xFF)};
+    int32_t centi = DPT::decode_dpt9_centi(data, sizeof(data));
+    if (std::fabs(centi * 0.01f - DPT::decode_dpt9(data, sizeof(data))) > std::fabs(centi) * 1e-6f) {
+      decode_errors++;
+    }
+    auto encoded = DPT::encode_dpt9_centi_fixed(centi);
+    if (DPT::decode_dpt9_centi(encoded.data(), encoded.size()) != centi) {
+      encode_errors++;
+    }
+  }
+  TEST_ASSERT(decode_errors == 0, "DPT9 centi decode matches float decode for all raw values");
+  TEST_ASSERT(encode_errors == 0, "DPT9 centi encode round-trips for all raw values");
+
+  auto encoded = DPT::encode_dpt9_centi_fixed(2050);  // 20.50: 1025 * 2^1
+  TEST_ASSERT(encoded[0] == 0x0C && encoded[1] == 0x01, "DPT9 centi encode 20.50");
+  encoded = DPT::encode_dpt9_centi_fixed(-1550);
+  TEST_ASSERT(DPT::decode_dpt9_centi(encoded.data(), encoded.size()) == -1550, "DPT9 centi round-trip -15.50");
+  encoded = DPT::encode_dpt9_centi_fixed(2049);  // 1024.5 * 2^1 rounds up
+  TEST_ASSERT(DPT::decode_dpt9_centi(encoded.data(), encoded.size()) == 2050, "DPT9 centi encode rounds");
+  encoded = DPT::encode_dpt9_centi_fixed(100000000);
+  TEST_ASSERT(DPT::decode_dpt9_centi(encoded.data(), encoded.size()) == 67076096, "DPT9 centi clamps to max");
+
+  // DPT 5.001 / 5.003: all 256 values against the float codecs
+  int pct_errors = 0, angle_errors = 0;
+  for (int raw = 0; raw <= 255; raw++) {
+    uint8_t data[1] = {static_cast<uint8_t>(raw)};
+    int32_t pct = DPT::decode_dpt5_percentage_centi(data, 1);
+    if (std::fabs(pct * 0.01f - DPT::decode_dpt5_percentage(data, 1)) > 0.005f ||
+        DPT::encode_dpt5_percentage_centi_fixed(pct)[0] != raw) {
+      pct_errors++;
+    }
+    int32_t angle = DPT::decode_dpt5_angle_centi(data, 1);
+    if (std::fabs(angle * 0.01f - DPT::decode_dpt5_angle(data, 1)) > 0.005f ||
+        DPT::encode_dpt5_angle_centi_fixed(angle)[0] != DPT::encode_dpt5_angle_fixed(angle * 0.01f)[0]) {
+      angle_errors++;
+    }
+  }
+  TEST_ASSERT(pct_errors == 0, "DPT5.001 centi codec matches float codec for all values");
+  TEST_ASSERT(angle_errors == 0, "DPT5.003 centi codec matches float codec for all values");
+  TEST_ASSERT(DPT::encode_dpt5_percentage_centi_fixed(15000)[0] == 255, "DPT5.001 centi clamps over 100%");
+  TEST_ASSERT(DPT::encode_dpt5_percentage_centi_fixed(-1000)[0] == 0, "DPT5.001 centi clamps under 0%");
+  TEST_ASSERT(DPT::encode_dpt5_angle_centi_fixed(-9000)[0] == DPT::encode_dpt5_angle_fixed(-90.0f)[0],
+              "DPT5.003 centi normalizes negative angles");
+  TEST_ASSERT(DPT::encode_dpt5_angle_centi_fixed(36000)[0] == 0, "DPT5.003 centi 360 wraps to 0");
+}
+
 void test_dpt14_float() {
   printf("\n=== Testing DPT 14 (4-byte float) ===\n");
 
@@ -272,6 +392,109 @@ void test_dpt20_hvac() {
   TEST_ASSERT(DPT::decode_dpt20_102({99}) == DPT::HVACMode::AUTO, "DPT20.102 decode invalid defaults to AUTO");
 }
 
+void test_fixed_encoders() {
+  printf("\n=== Testing fixed-size encoders ===\n");
+
+  // Same bytes as the vector encoders, sized per DPT at compile time
+  auto same = [](const std::vector<uint8_t> &vec, const uint8_t *raw, size_t len) {
+    return vec.size() == len && std::equal(vec.begin(), vec.end(), raw);
+  };
+  auto dpt1 = DPT::encode_dpt1_fixed(true);
+  TEST_ASSERT(same(DPT::encode_dpt1(true), dpt1.data(), dpt1.size()), "DPT1 fixed matches vector");
+  auto dpt5 = DPT::encode_dpt5_percentage_fixed(50.0f);
+  TEST_ASSERT(same(DPT::encode_dpt5_percentage(50.0f), dpt5.data(), dpt5.size()), "DPT5.001 fixed matches vector");
+  auto dpt9 = DPT::encode_dpt9_fixed(-15.5f);
+  TEST_ASSERT(same(DPT::encode_dpt9(-15.5f), dpt9.data(), dpt9.size()), "DPT9 fixed matches vector");
+  auto dpt14 = DPT::encode_dpt14_fixed(123.456f);
+  TEST_ASSERT(same(DPT::encode_dpt14(123.456f), dpt14.data(), dpt14.size()), "DPT14 fixed matches vector");
+  auto dpt20 = DPT::encode_dpt20_102_fixed(DPT::HVACMode::NIGHT);
+  TEST_ASSERT(same(DPT::encode_dpt20_102(DPT::HVACMode::NIGHT), dpt20.data(), dpt20.size()),
+              "DPT20.102 fixed matches vector");
+
+  DPT::DateTime dt = {2024, 6, 15, 6, 14, 30, 45, 0, false, true, false, false, false, false, false, false};
+  auto dpt19 = DPT::encode_dpt19_fixed(dt);
+  TEST_ASSERT(same(DPT::encode_dpt19(dt), dpt19.data(), dpt19.size()), "DPT19 fixed matches vector");
+
+  // DPT 16 is always a full 14-byte frame, zero padded
+  auto dpt16 = DPT::encode_dpt16_fixed("Hello KNX");
+  TEST_ASSERT(dpt16.size() == 14 && dpt16[8] == 'X' && dpt16[9] == 0 && dpt16[13] == 0, "DPT16 fixed zero padded");
+  TEST_ASSERT(DPT::decode_dpt16(dpt16.data(), dpt16.size()) == "Hello KNX", "DPT16 fixed decodes back");
+  auto dpt16_long = DPT::encode_dpt16_fixed("12345678901234567890");
+  TEST_ASSERT(DPT::decode_dpt16(dpt16_long.data(), dpt16_long.size()) == "12345678901234", "DPT16 fixed truncates to 14");
+}
+
+// Lookups resolve at compile time
+static_assert(find_dpt(9, 1) == &DPT_9_001, "DPT 9.001 in the registry");
+static_assert(find_dpt(251, 600)->bits == 48, "DPT 251.600 is 6 bytes");
+static_assert(find_dpt(9, 999) == nullptr, "Unknown DPT not found");
+
+void test_dpt_registry() {
+  printf("\n=== Testing generic DPT codecs ===\n");
+
+  uint8_t out[8];
+
+  // Same results as the dedicated codecs for today's types
+  int mismatches = 0;
+  for (int raw = 0; raw <= 255; raw++) {
+    uint8_t data[1] = {static_cast<uint8_t>(raw)};
+    if (DPT::decode(DPT_5_001, data, 1) != DPT::decode_dpt5_percentage(data, 1) ||
+        DPT::decode(DPT_5_003, data, 1) != DPT::decode_dpt5_angle(data, 1) ||
+        DPT::decode_centi(DPT_5_001, data, 1) != DPT::decode_dpt5_percentage_centi(data, 1)) {
+      mismatches++;
+    }
+    float pct = DPT::decode_dpt5_percentage(data, 1);
+    if (DPT::encode(DPT_5_001, pct, out) != 1 || out[0] != DPT::encode_dpt5_percentage_fixed(pct)[0]) {
+      mismatches++;
+    }
+  }
+  TEST_ASSERT(mismatches == 0, "Generic DPT 5.001/5.003 match the dedicated codecs");
+
+  uint8_t dpt9[2] = {0x0C, 0x1A};
+  TEST_ASSERT(DPT::decode(DPT_9_001, dpt9, 2) == DPT::decode_dpt9(dpt9, 2), "Generic DPT 9 decode");
+  TEST_ASSERT(DPT::encode(DPT_9_001, -300.0f, out) == 2 && std::fabs(DPT::decode_dpt9(out, 2) + 273.0f) < 0.1f,
+              "Generic DPT 9.001 clamps to -273 °C");
+
+  // DPT 7 / 8: 2-byte integers, scaled
+  TEST_ASSERT(DPT::encode(DPT_7_013, 1234.0f, out) == 2 && out[0] == 0x04 && out[1] == 0xD2, "DPT 7.013 encode");
+  TEST_ASSERT(DPT::decode(DPT_7_013, out, 2) == 1234.0f, "DPT 7.013 decode");
+  TEST_ASSERT(DPT::encode(DPT_7_003, 1000.0f, out) == 2 && out[0] == 0x00 && out[1] == 0x64, "DPT 7.003 10 ms steps");
+  TEST_ASSERT(DPT::encode(DPT_7_001, 70000.0f, out) == 2 && out[0] == 0xFF && out[1] == 0xFF, "DPT 7 clamps");
+  TEST_ASSERT(DPT::encode(DPT_8_010, -12.5f, out) == 2 && out[0] == 0xFB && out[1] == 0x1E, "DPT 8.010 encode");
+  TEST_FLOAT_EQUAL(DPT::decode(DPT_8_010, out, 2), -12.5f, 0.001f, "DPT 8.010 decode");
+  TEST_ASSERT(DPT::decode_centi(DPT_8_010, out, 2) == -1250, "DPT 8.010 decode centi");
+
+  // DPT 12 / 13: 4-byte integers
+  uint8_t dpt12[4] = {0xFF, 0xFF, 0xFF, 0xFF};
+  TEST_ASSERT(DPT::decode(DPT_12_001, dpt12, 4) == 4294967295.0f, "DPT 12.001 decode max");
+  TEST_ASSERT(DPT::decode(DPT_13_010, dpt12, 4) == -1.0f, "DPT 13.010 decode -1");
+  TEST_ASSERT(DPT::encode(DPT_12_001, 1e12f, out) == 4 && out[0] == 0xFF && out[3] == 0xFF, "DPT 12 saturates");
+  TEST_ASSERT(DPT::encode(DPT_13_010, -1e12f, out) == 4 && out[0] == 0x80 && out[3] == 0x00, "DPT 13 saturates");
+  TEST_ASSERT(DPT::encode(DPT_13_010, -123456.0f, out) == 4 && DPT::decode(DPT_13_010, out, 4) == -123456.0f,
+              "DPT 13.010 round-trip");
+  TEST_ASSERT(DPT::decode_centi(DPT_13_010, dpt12, 4) == -100, "DPT 13 decode centi");
+  TEST_ASSERT(DPT::decode_centi(DPT_12_001, dpt12, 4) == INT32_MAX, "DPT 12 decode centi saturates");
+  TEST_ASSERT(DPT::decode(DPT_13_010, dpt12, 3) == 0.0f, "DPT 13 decode short data");
+
+  // DPT 17 / 18: scenes
+  TEST_ASSERT(DPT::encode(DPT_17_001, 12.0f, out) == 1 && out[0] == 12, "DPT 17.001 encode");
+  uint8_t learn[1] = {0x85};
+  TEST_ASSERT(DPT::decode(DPT_18_001, learn, 1) == 133.0f, "DPT 18.001 decode learn scene 5");
+  TEST_ASSERT(DPT::decode(DPT_17_001, learn, 1) == 5.0f, "DPT 17.001 decode masks to 6 bits");
+
+  // DPT 232 / 251: colours
+  DPT::Color rgb = {255, 128, 0, 0, 0};
+  TEST_ASSERT(DPT::encode_color(DPT_232_600, rgb, out) == 3 && out[0] == 255 && out[1] == 128 && out[2] == 0,
+              "DPT 232.600 encode");
+  DPT::Color rgbw = {10, 20, 30, 40, 0x0F};
+  TEST_ASSERT(DPT::encode_color(DPT_251_600, rgbw, out) == 6 && out[3] == 40 && out[4] == 0 && out[5] == 0x0F,
+              "DPT 251.600 encode");
+  out[5] = 0x09;  // Only R and W valid
+  auto color = DPT::decode_color(DPT_251_600, out, 6);
+  TEST_ASSERT(color.red == 10 && color.green == 0 && color.blue == 0 && color.white == 40 && color.valid == 0x09,
+              "DPT 251.600 decode honours the validity mask");
+  TEST_ASSERT(DPT::encode(DPT_232_600, 1.0f, out) == 0, "Scalar encode refuses colour DPTs");
+}
+
 int main() {
   printf("\n");
   printf("╔════════════════════════════════════════════════════════════╗\n");
@@ -281,14 +504,19 @@ int main() {
 
   // Run all tests
   test_dpt1_bool();
+  test_dpt3_dimming();
   test_dpt5_uint8();
   test_dpt5_percentage();
   test_dpt5_angle();
   test_dpt9_float();
+  test_dpt9_exhaustive();
+  test_centi_codecs();
   test_dpt14_float();
   test_dpt16_string();
   test_dpt19_datetime();
   test_dpt20_hvac();
+  test_fixed_encoders();
+  test_dpt_registry();
 
   // Print summary
   printf("\n");
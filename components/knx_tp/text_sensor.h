@@ -15,11 +15,12 @@ class KNXTextSensor : public text_sensor::TextSensor, public Component, public K
  public:
   void setup() override;
   void dump_config() override;
-  void set_state_ga_id(const std::string &ga_id) { state_ga_id_ = ga_id; }
+  void set_state_ga(GroupAddress *ga) { state_ga_ = ga; }
   void set_dpt_type(TextSensorDPT dpt) { dpt_type_ = dpt; }
-  void on_knx_telegram(const std::string &ga, const std::vector<uint8_t> &data) override;
+  void on_knx_group_value(uint8_t role, uint16_t ga, const uint8_t *data, uint8_t len) override;
+  bool uses_listeners() const override { return true; }
  protected:
-  std::string state_ga_id_;
+  GroupAddress *state_ga_{nullptr};
   TextSensorDPT dpt_type_ = TextSensorDPT::DPT_16;
 };
 }}
\ No newline at end of file
@@ -2,7 +2,7 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import text_sensor
 from esphome.const import CONF_ID
-from . import knx_tp_ns, KNXTPComponent, const
+from . import knx_tp_ns, KNXTPComponent, GroupAddress, use_group_address, const
 
 DEPENDENCIES = ["knx_tp"]
 
@@ -24,7 +24,7 @@ DPT_TYPES = {
 CONFIG_SCHEMA = text_sensor.text_sensor_schema(KNXTextSensor).extend({
     cv.GenerateID(): cv.declare_id(KNXTextSensor),
     cv.GenerateID("knx_id"): cv.use_id(KNXTPComponent),
-    cv.Required(const.CONF_STATE_GA): cv.string,
+    cv.Required(const.CONF_STATE_GA): cv.use_id(GroupAddress),
     cv.Optional(const.CONF_DPT_TYPE, default="16"): cv.enum(DPT_TYPES, upper=False),
 }).extend(cv.COMPONENT_SCHEMA)
 
@@ -34,5 +34,6 @@ async def to_code(config):
     await text_sensor.register_text_sensor(var, config)
     knx = await cg.get_variable(config["knx_id"])
     cg.add(var.set_knx_component(knx))
-    cg.add(var.set_state_ga_id(config[const.CONF_STATE_GA]))
+    cg.add(var.set_state_ga(await cg.get_variable(config[const.CONF_STATE_GA])))
+    use_group_address(config[const.CONF_STATE_GA], const.GO_LISTEN, const.DPT_VALUE_BITS[int(config[const.CONF_DPT_TYPE])])
     cg.add(var.set_dpt_type(config[const.CONF_DPT_TYPE]))
\ No newline at end of file
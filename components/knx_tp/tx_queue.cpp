@@ -0,0 +1,73 @@
+#include "tx_queue.h"
+#include <cstring>
+
+namespace esphome {
+namespace knx_tp {
+
+TxQueue::TxQueue() {
+  // Every slot starts on the free list
+  for (uint8_t i = 0; i < KNX_TX_QUEUE_SIZE; i++) {
+    this->next_[i] = i + 1 < KNX_TX_QUEUE_SIZE ? i + 1 : NONE;
+  }
+  for (uint8_t p = 0; p < KNX_PRIORITY_COUNT; p++) {
+    this->head_[p] = NONE;
+    this->tail_[p] = NONE;
+  }
+}
+
+KNXFrame *TxQueue::push(uint16_t ga, KNXService service, KNXPriority priority, const uint8_t *data, size_t len) {
+  if (this->free_ == NONE || len > KNXFrame::MAX_DATA || priority >= KNX_PRIORITY_COUNT) {
+    return nullptr;
+  }
+
+  uint8_t index = this->free_;
+  this->free_ = this->next_[index];
+
+  KNXFrame &frame = this->slots_[index];
+  frame.ga = ga;
+  frame.service = service;
+  frame.priority = priority;
+  frame.len = len;
+  if (len > 0) {
+    memcpy(frame.data, data, len);
+  }
+  frame.on_complete = nullptr;
+
+  // Append to the FIFO of its class
+  this->next_[index] = NONE;
+  if (this->tail_[priority] == NONE) {
+    this->head_[priority] = index;
+  } else {
+    this->next_[this->tail_[priority]] = index;
+  }
+  this->tail_[priority] = index;
+  this->queued_++;
+  return &frame;
+}
+
+KNXFrame *TxQueue::pop() {
+  for (uint8_t p = 0; p < KNX_PRIORITY_COUNT; p++) {
+    uint8_t index = this->head_[p];
+    if (index == NONE) {
+      continue;
+    }
+    this->head_[p] = this->next_[index];
+    if (this->head_[p] == NONE) {
+      this->tail_[p] = NONE;
+    }
+    this->next_[index] = NONE;
+    this->queued_--;
+    return &this->slots_[index];
+  }
+  return nullptr;
+}
+
+void TxQueue::release(KNXFrame *frame) {
+  uint8_t index = frame - this->slots_;
+  frame->on_complete = nullptr;  // Drop captured state now, not when the slot is reused
+  this->next_[index] = this->free_;
+  this->free_ = index;
+}
+
+}  // namespace knx_tp
+}  // namespace esphome
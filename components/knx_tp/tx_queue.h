@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+
+// Number of frames that can wait for the bus (all priorities together)
+// Can be overridden with build flags: -DKNX_TX_QUEUE_SIZE=64
+#ifndef KNX_TX_QUEUE_SIZE
+#define KNX_TX_QUEUE_SIZE 32
+#endif
+
+namespace esphome {
+namespace knx_tp {
+
+/**
+ * KNX priority classes, highest first
+ * Frames of a higher class are always sent before queued lower ones.
+ */
+enum KNXPriority : uint8_t {
+  KNX_PRIORITY_SYSTEM = 0,
+  KNX_PRIORITY_URGENT,
+  KNX_PRIORITY_NORMAL,
+  KNX_PRIORITY_LOW,
+  KNX_PRIORITY_COUNT,
+};
+
+/**
+ * Group service carried by a queued frame
+ */
+enum class KNXService : uint8_t {
+  WRITE,     // GroupValue_Write
+  READ,      // GroupValue_Read
+  RESPONSE,  // GroupValue_Response
+};
+
+/**
+ * Per-frame completion: true when the bus confirmed the frame (L_Data.con OK),
+ * false on a negative confirmation, timeout, or when it could not be queued
+ */
+using KNXTxCallback = std::function<void(bool success)>;
+
+/**
+ * A group telegram waiting for (or on) the bus
+ */
+struct KNXFrame {
+  static constexpr uint8_t MAX_DATA = 14;  // Largest group value (DPT 16)
+
+  uint16_t ga;
+  KNXService service;
+  KNXPriority priority;
+  uint8_t len;
+  uint8_t data[MAX_DATA];
+  KNXTxCallback on_complete;
+};
+
+/**
+ * Bounded transmit queue with the four KNX priority classes
+ *
+ * All classes share one fixed pool of KNX_TX_QUEUE_SIZE frames, each class
+ * being a FIFO threaded through the pool, so nothing is allocated after boot
+ * and a burst of one class can use the whole pool. pop() hands out the oldest
+ * frame of the highest non-empty class; the slot stays owned by the caller
+ * until release().
+ */
+class TxQueue {
+ public:
+  TxQueue();
+
+  /**
+   * Queue a frame; returns nullptr (and queues nothing) when the pool is full
+   * or the payload is too long. The returned frame's data is already copied.
+   */
+  KNXFrame *push(uint16_t ga, KNXService service, KNXPriority priority, const uint8_t *data, size_t len);
+
+  KNXFrame *pop();
+  void release(KNXFrame *frame);
+
+  bool empty() const { return this->queued_ == 0; }
+  size_t size() const { return this->queued_; }
+  static constexpr size_t capacity() { return KNX_TX_QUEUE_SIZE; }
+
+ protected:
+  static constexpr uint8_t NONE = 0xFF;
+  static_assert(KNX_TX_QUEUE_SIZE < NONE, "KNX_TX_QUEUE_SIZE must be below 255");
+
+  KNXFrame slots_[KNX_TX_QUEUE_SIZE];
+  uint8_t next_[KNX_TX_QUEUE_SIZE];  // Next slot in the same FIFO (or free list)
+  uint8_t head_[KNX_PRIORITY_COUNT];
+  uint8_t tail_[KNX_PRIORITY_COUNT];
+  uint8_t free_{0};
+  uint8_t queued_{0};
+};
+
+}  // namespace knx_tp
+}  // namespace esphome